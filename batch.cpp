@@ -0,0 +1,406 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "batch.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "mapped_file.h"
+#include "parser.h"
+#include "watch.h"
+
+namespace {
+
+constexpr uint64_t kFnvOffsetBasis = 0xCBF29CE484222325u;
+constexpr uint64_t kFnvPrime = 0x100000001B3u;
+
+// journal lines are synced after this many inputs or seconds
+constexpr size_t kJournalSyncInputs = 1000u;
+constexpr std::chrono::seconds kJournalSyncTime{5};
+
+uint64_t Fnv1a(const uint8_t* data_ptr, const size_t size, uint64_t hash = kFnvOffsetBasis) {
+  for (size_t index = 0u; index < size; ++index) {
+    hash = (hash ^ data_ptr[index]) * kFnvPrime;
+  }
+  return hash;
+}
+
+// input of the shard and its result for the manifest
+struct BatchFile {
+  std::filesystem::path relative_path;
+  bool converted{false};
+};
+
+// checksum of the outputs of the input, throws if an output can not be read
+uint64_t OutputsChecksum(const std::filesystem::path& output_file, const std::vector<std::string>& types) {
+  uint64_t checksum = kFnvOffsetBasis;
+  for (const std::string& type : types) {
+    const MappedFile output(std::filesystem::path(output_file).replace_extension(type));
+    checksum = Fnv1a(output.GetData(), output.GetSize(), checksum);
+  }
+  return checksum;
+}
+
+#ifndef __linux__
+// flushes the file to the disk, a directory too on posix, so the renames in it are durable
+bool SyncFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+  const int file_descriptor = _wopen(path.c_str(), _O_WRONLY | _O_BINARY);
+  if (file_descriptor < 0) {
+    return false;
+  }
+  const bool synced = _commit(file_descriptor) == 0;
+  _close(file_descriptor);
+#else
+  const int file_descriptor = open(path.c_str(), O_RDONLY);
+  if (file_descriptor < 0) {
+    return false;
+  }
+  const bool synced = fsync(file_descriptor) == 0;
+  close(file_descriptor);
+#endif
+  return synced;
+}
+#endif
+
+// outputs of the inputs of the journal lines that are not written yet
+bool SyncOutputs(const std::filesystem::path& output_directory, const std::vector<std::filesystem::path>& outputs) {
+#ifdef __linux__
+  // one call for all of them, the outputs are on the file system of the output directory
+  (void)outputs;
+  const int file_descriptor = open(output_directory.c_str(), O_RDONLY | O_DIRECTORY);
+  if (file_descriptor < 0) {
+    return false;
+  }
+  const bool synced = syncfs(file_descriptor) == 0;
+  close(file_descriptor);
+  return synced;
+#else
+  (void)output_directory;
+  std::vector<std::filesystem::path> directories;
+  for (const std::filesystem::path& output : outputs) {
+    if (!SyncFile(output)) {
+      return false;
+    }
+#ifndef _WIN32
+    directories.push_back(output.parent_path());
+#endif
+  }
+  std::sort(directories.begin(), directories.end());
+  directories.erase(std::unique(directories.begin(), directories.end()), directories.end());
+  return std::all_of(directories.begin(), directories.end(), SyncFile);
+#endif
+}
+
+// append only journal of the converted inputs, one line per input: relative path, size, modification time in nanoseconds since 1970,
+// checksum of the outputs and conversion time in microseconds delimited by tabs. lines are kept in memory and written in batches: the
+// outputs of the batch are synced first, then its lines are written and the journal is synced, so a line is never on the disk before its
+// outputs. the replay skips a line cut by a crash, the input of a line is converted again when its outputs are missing or changed
+class Journal {
+ public:
+  Journal(const std::filesystem::path& path, const std::filesystem::path& output_directory, const bool resume)
+      : output_directory_(output_directory) {
+    // the last line is cut by a crash, the new lines start after it
+    bool terminated{true};
+    if (resume) {
+      std::ifstream journal_stream(path, std::ios::binary);
+      std::string line;
+      while (std::getline(journal_stream, line)) {
+        terminated = !journal_stream.eof();
+        Replay(line);
+      }
+      SPDLOG_INFO("{} converted input(s) in the journal '{}'", completed_.size(), path.string());
+    }
+    file_ = std::fopen(path.string().c_str(), resume ? "ab" : "wb");
+    if (file_ == nullptr) {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+    if (!terminated) {
+      std::fputc('\n', file_);
+    }
+  }
+
+  ~Journal() {
+    Sync();
+    std::fclose(file_);
+  }
+
+  Journal(const Journal&) = delete;
+  Journal& operator=(const Journal&) = delete;
+
+  // the input was converted with the same size and modification time and its outputs are not changed since
+  bool Converted(const std::string& relative_path, const uint64_t size, const int64_t modified, const std::filesystem::path& output_file,
+                 const std::vector<std::string>& types) const {
+    const auto it = completed_.find(relative_path);
+    if (it == completed_.end() || it->second.size != size || it->second.modified != modified) {
+      return false;
+    }
+    try {
+      return OutputsChecksum(output_file, types) == it->second.checksum;
+    } catch (const std::system_error&) {
+      return false;
+    }
+  }
+
+  void Append(const std::string& relative_path, const uint64_t size, const int64_t modified, const std::filesystem::path& output_file,
+              const std::vector<std::string>& types, const uint64_t checksum, const int64_t microseconds) {
+    std::array<char, 96> numbers;
+    const int numbers_size =
+        std::snprintf(numbers.data(), numbers.size(), "\t%llu\t%lld\t%016llx\t%lld\n", static_cast<unsigned long long>(size),
+                      static_cast<long long>(modified), static_cast<unsigned long long>(checksum), static_cast<long long>(microseconds));
+    const std::lock_guard<std::mutex> lock(mutex_);
+    pending_lines_.append(relative_path).append(numbers.data(), static_cast<size_t>(numbers_size));
+    for (const std::string& type : types) {
+      pending_outputs_.push_back(std::filesystem::path(output_file).replace_extension(type));
+    }
+    if (++pending_inputs_ >= kJournalSyncInputs || std::chrono::steady_clock::now() - synced_ >= kJournalSyncTime) {
+      Sync();
+    }
+  }
+
+ private:
+  struct Entry {
+    uint64_t size{0u};
+    int64_t modified{0};
+    uint64_t checksum{0u};
+  };
+
+  void Replay(const std::string& line) {
+    // the path can have tabs, the numbers are the last 4 fields
+    std::array<size_t, 4u> tabs;
+    size_t end = line.size();
+    for (size_t& tab : tabs) {
+      tab = end == 0u ? std::string::npos : line.rfind('\t', end - 1u);
+      if (tab == std::string::npos) {
+        return;
+      }
+      end = tab;
+    }
+    Entry entry;
+    const char* line_ptr = line.data();
+    if (std::from_chars(line_ptr + tabs[3] + 1u, line_ptr + tabs[2], entry.size).ptr != line_ptr + tabs[2] ||
+        std::from_chars(line_ptr + tabs[2] + 1u, line_ptr + tabs[1], entry.modified).ptr != line_ptr + tabs[1] ||
+        std::from_chars(line_ptr + tabs[1] + 1u, line_ptr + tabs[0], entry.checksum, 16).ptr != line_ptr + tabs[0] ||
+        tabs[0] + 1u == line.size()) {
+      return;
+    }
+    completed_[line.substr(0u, tabs[3])] = entry;
+  }
+
+  // writes the lines after their outputs are on the disk
+  void Sync() {
+    if (pending_lines_.empty()) {
+      return;
+    }
+    if (SyncOutputs(output_directory_, pending_outputs_)) {
+      std::fwrite(pending_lines_.data(), 1u, pending_lines_.size(), file_);
+      std::fflush(file_);
+#ifdef _WIN32
+      _commit(_fileno(file_));
+#else
+      fsync(fileno(file_));
+#endif
+    } else {
+      SPDLOG_WARN("outputs can not be synced, {} input(s) are not journaled and will be converted again", pending_inputs_);
+    }
+    pending_lines_.clear();
+    pending_outputs_.clear();
+    pending_inputs_ = 0u;
+    synced_ = std::chrono::steady_clock::now();
+  }
+
+  // inputs of the previous runs
+  std::unordered_map<std::string, Entry> completed_;
+  const std::filesystem::path output_directory_;
+  std::FILE* file_{nullptr};
+  std::mutex mutex_;
+  std::string pending_lines_;
+  std::vector<std::filesystem::path> pending_outputs_;
+  size_t pending_inputs_{0u};
+  std::chrono::steady_clock::time_point synced_{std::chrono::steady_clock::now()};
+};
+
+}  // namespace
+
+std::vector<std::filesystem::path> CollectFitFiles(const std::vector<std::string>& inputs) {
+  std::vector<std::filesystem::path> fit_files;
+  auto is_fit_file = [](const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+    return extension == ".fit";
+  };
+  for (const std::string& input : inputs) {
+    if (std::filesystem::is_directory(input)) {
+      for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+        if (entry.is_regular_file() && is_fit_file(entry.path())) {
+          fit_files.push_back(entry.path());
+        }
+      }
+    } else {
+      fit_files.emplace_back(input);
+    }
+  }
+  std::sort(fit_files.begin(), fit_files.end());
+  return fit_files;
+}
+
+bool ParseShard(const std::string_view text, Shard& shard) {
+  const size_t slash = text.find('/');
+  if (slash == std::string_view::npos) {
+    return false;
+  }
+  Shard parsed;
+  const auto [index_end, index_error] = std::from_chars(text.data(), text.data() + slash, parsed.index);
+  const auto [count_end, count_error] = std::from_chars(text.data() + slash + 1u, text.data() + text.size(), parsed.count);
+  if (index_error != std::errc() || count_error != std::errc() || index_end != text.data() + slash || count_end != text.data() + text.size() ||
+      parsed.index < 1u || parsed.index > parsed.count) {
+    return false;
+  }
+  shard = parsed;
+  return true;
+}
+
+size_t ShardOf(const std::filesystem::path& relative_path, const size_t shards) {
+  const std::u8string path = relative_path.generic_u8string();
+  return static_cast<size_t>(Fnv1a(reinterpret_cast<const uint8_t*>(path.data()), path.size()) % shards) + 1u;
+}
+
+bool ConvertBatch(const std::filesystem::path& directory, const std::filesystem::path& output_directory, const std::vector<std::string>& types,
+                  const Shard& shard, const size_t workers, const bool resume,
+                  const std::function<bool(const std::filesystem::path& fit_file, const std::filesystem::path& output_file)>& convert) {
+  std::vector<BatchFile> files;
+  const std::vector<std::filesystem::path> fit_files = CollectFitFiles({directory.string()});
+  for (const std::filesystem::path& fit_file : fit_files) {
+    std::filesystem::path relative_path = fit_file.lexically_relative(directory);
+    if (ShardOf(relative_path, shard.count) == shard.index) {
+      files.push_back(BatchFile{std::move(relative_path)});
+    }
+  }
+  SPDLOG_INFO("shard {}/{}: {} of {} .fit file(s)", shard.index, shard.count, files.size(), fit_files.size());
+
+  const std::string shard_name = "shard-" + std::to_string(shard.index) + "-of-" + std::to_string(shard.count);
+  std::filesystem::create_directories(output_directory);
+  Journal journal(output_directory / (shard_name + ".journal"), output_directory, resume);
+  std::atomic<size_t> next_file{0u};
+  std::atomic<size_t> skipped{0u};
+  std::mutex slowest_mutex;
+  std::pair<int64_t, std::string> slowest{0, ""};
+  auto worker = [&]() {
+    for (size_t index = next_file++; index < files.size(); index = next_file++) {
+      BatchFile& file = files[index];
+      const std::string relative_path = file.relative_path.generic_string();
+      const std::filesystem::path fit_file = directory / file.relative_path;
+      const std::filesystem::path output_file = output_directory / file.relative_path;
+      try {
+        const uint64_t size = std::filesystem::file_size(fit_file);
+        const int64_t modified = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::file_clock::to_sys(std::filesystem::last_write_time(fit_file)).time_since_epoch())
+                                     .count();
+        if (journal.Converted(relative_path, size, modified, output_file, types)) {
+          file.converted = true;
+          ++skipped;
+          continue;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        std::filesystem::create_directories(output_file.parent_path());
+        file.converted = convert(fit_file, output_file);
+        const int64_t microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        if (file.converted) {
+          journal.Append(relative_path, size, modified, output_file, types, OutputsChecksum(output_file, types), microseconds);
+        }
+        const std::lock_guard<std::mutex> lock(slowest_mutex);
+        if (microseconds > slowest.first) {
+          slowest = {microseconds, relative_path};
+        }
+      } catch (const std::exception& e) {
+        file.converted = false;
+        SPDLOG_WARN("'{}' can not be converted: {}", relative_path, e.what());
+      }
+    }
+  };
+  const size_t workers_count = std::clamp<size_t>(workers, 1u, std::max<size_t>(files.size(), 1u));
+  std::vector<std::thread> threads;
+  for (size_t index = 1u; index < workers_count; ++index) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  rapidjson::StringBuffer manifest;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(manifest);
+  size_t failed{0u};
+  writer.StartObject();
+  writer.Key("shard");
+  writer.Uint64(shard.index);
+  writer.Key("shards");
+  writer.Uint64(shard.count);
+  writer.Key("files");
+  writer.StartArray();
+  for (const BatchFile& file : files) {
+    writer.StartObject();
+    writer.Key("input");
+    writer.String(file.relative_path.generic_string().c_str());
+    writer.Key("outputs");
+    writer.StartArray();
+    for (const std::string& type : types) {
+      writer.String(std::filesystem::path(file.relative_path).replace_extension(type).generic_string().c_str());
+    }
+    writer.EndArray();
+    writer.Key("converted");
+    writer.Bool(file.converted);
+    writer.EndObject();
+    failed += file.converted ? 0u : 1u;
+  }
+  writer.EndArray();
+  writer.EndObject();
+  const std::string manifest_name = shard_name + ".json";
+  WriteFileAtomically(output_directory / manifest_name, manifest.GetString(), manifest.GetSize());
+  SPDLOG_INFO("shard {}/{}: {} .fit file(s) converted ({} by previous runs), {} failed, manifest '{}'", shard.index, shard.count,
+              files.size() - failed, skipped.load(), failed, manifest_name);
+  if (!slowest.second.empty()) {
+    SPDLOG_INFO("the slowest is '{}': {:.1f} ms, times of all files are in the journal", slowest.second, slowest.first / 1000.0);
+  }
+  return failed == 0u;
+}
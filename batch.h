@@ -0,0 +1,56 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// part of the batch conversion for one of several nodes or processes, index is from 1 to count
+struct Shard {
+  size_t index{1u};
+  size_t count{1u};
+};
+
+// .fit files of the inputs, directories are searched recursively
+std::vector<std::filesystem::path> CollectFitFiles(const std::vector<std::string>& inputs);
+
+// "i/N" with 1 <= i <= N, false if the text is not a shard
+bool ParseShard(const std::string_view text, Shard& shard);
+
+// shard index (from 1) of the path relative to the batch directory, it is the same on every node: FNV-1a of the path with '/' separators
+size_t ShardOf(const std::filesystem::path& relative_path, const size_t shards);
+
+// converts the .fit files of the directory (recursively) that belong to the shard by a pool of workers threads, the outputs of
+// directory/relative.fit are output_directory/relative with the extension of every type and are written by convert, false if it failed.
+// the manifest output_directory/shard-i-of-N.json lists every input of the shard with its outputs and result, the whole batch is
+// done when all N manifests have all inputs converted. converted inputs are appended to the journal output_directory/shard-i-of-N.journal
+// with the checksum of the outputs and the conversion time after the outputs are synced to the disk, resume skips the inputs of the
+// journal that have the same size and modification time and the outputs with the same checksum, otherwise the journal is started again.
+// false if some inputs are failed
+bool ConvertBatch(const std::filesystem::path& directory, const std::filesystem::path& output_directory, const std::vector<std::string>& types,
+                  const Shard& shard, const size_t workers, const bool resume,
+                  const std::function<bool(const std::filesystem::path& fit_file, const std::filesystem::path& output_file)>& convert);
@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "datasource.h"
+#include "kernels.h"
 #include "parser.h"
 
 
@@ -61,6 +62,18 @@ static void BM_VttExpor(benchmark::State& state) {
   }
 }
 
+// the fixed layout as a template, should not be slower than BM_VttExpor
+static void BM_VttTemplateExport(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<std::unique_ptr<DataSource>> data_sources;
+    data_sources.push_back(std::make_unique<DataSourceMemory>(fit_file.data(), fit_file.size()));
+    ConvertOptions options;
+    options.cue_template = "{speed} km/h {distance} km {hr}bpm {cadence} rpm {power}W {temperature}°C {altitude} m";
+    const std::unique_ptr<FitResult> result{Convert(std::move(data_sources), "vtt", 0, 0, 0xFFFFFF, false, std::move(options))};
+    benchmark::DoNotOptimize(result);
+  }
+}
+
 static void BM_JsonExport(benchmark::State& state) {
   for (auto _ : state) {
     auto data_source = std::make_unique<DataSourceMemory>(fit_file.data(), fit_file.size());
@@ -77,9 +90,38 @@ static void BM_FitOnlyExport(benchmark::State& state) {
   }
 }
 
+// record filter comparison and masks of every instruction set the cpu supports
+static void BM_FilterKernels(benchmark::State& state) {
+  const Kernels& kernels = KernelsFor(static_cast<Isa>(state.range(0)));
+  constexpr size_t kValues = 256u;
+  std::vector<double> values(kValues);
+  std::vector<uint8_t> present(kValues, 1u);
+  std::vector<uint8_t> left(kValues);
+  std::vector<uint8_t> right(kValues);
+  for (size_t index = 0u; index < kValues; ++index) {
+    values[index] = static_cast<double>(index % 97u);
+  }
+  for (auto _ : state) {
+    kernels.compare[static_cast<size_t>(CompareOp::kGreater)](values.data(), present.data(), kValues, 40.0, left.data());
+    kernels.compare[static_cast<size_t>(CompareOp::kLessEqual)](values.data(), present.data(), kValues, 80.0, right.data());
+    kernels.mask_and(left.data(), right.data(), kValues);
+    kernels.mask_not(left.data(), kValues);
+    benchmark::DoNotOptimize(left.data());
+  }
+  state.SetLabel(std::string(IsaName(kernels.isa)));
+}
+
+static void FilterKernelsArguments(benchmark::internal::Benchmark* benchmark) {
+  for (const Isa isa : SupportedIsas()) {
+    benchmark->Arg(static_cast<int64_t>(isa));
+  }
+}
+
 BENCHMARK(BM_JsonExport);
 BENCHMARK(BM_VttExpor);
+BENCHMARK(BM_VttTemplateExport);
 BENCHMARK(BM_FitOnlyExport);
+BENCHMARK(BM_FilterKernels)->Apply(FilterKernelsArguments);
 
 // Run the benchmark
 int main(int argc, char** argv) {
@@ -89,6 +131,8 @@ int main(int argc, char** argv) {
 
     fit_file = readFileToBuffer("300.fit");
 
+    // selected for the whole run, FITCONVERT_ISA forces another one
+    ::benchmark::AddCustomContext("isa", std::string(IsaName(ActiveKernels().isa)));
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
   } catch (const std::exception& e) {
@@ -46,7 +46,7 @@ DataSource::Status DataSource::ReadDataInternal(std::istream& stream, Buffer& bu
 
 DataSourceFile::DataSourceFile(const std::string source_name)
     : DataSource(DataSource::Type::kFile), source_name_(source_name) {
-  stream_ = std::make_unique<std::ifstream>(source_name_, std::ios::in | std::ios::app | std::ios::binary);
+  stream_ = std::make_unique<std::ifstream>(source_name_, std::ios::in | std::ios::binary);
   stream_->exceptions(std::ios_base::badbit);
 }
 
@@ -95,3 +95,7 @@ DataSource::Status DataSourceMemory::ReadData(Buffer& buffer) {
 size_t DataSourceMemory::GetSize() const {
   return count_;
 }
+
+const uint8_t* DataSourceMemory::GetContiguousData() const {
+  return buffer_ptr_;
+}
@@ -72,6 +72,9 @@ class DataSource {
 
   virtual size_t GetSize() const = 0;
 
+  // whole data if the source is a contiguous buffer, nullptr otherwise
+  virtual const uint8_t* GetContiguousData() const { return nullptr; }
+
  protected:
   Status ReadDataInternal(std::istream& stream, Buffer& buffer);
 
@@ -111,6 +114,8 @@ class DataSourceMemory final : public DataSource {
 
   size_t GetSize() const override;
 
+  const uint8_t* GetContiguousData() const override;
+
  private:
   const uint8_t* buffer_ptr_{nullptr};
   const size_t count_{0};
@@ -0,0 +1,150 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "dem.h"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+// void in the .hgt data
+constexpr int16_t kHgtVoid = -32768;
+
+// samples per side of 3 and 1 arc second tiles
+constexpr size_t kHgtSamples3 = 1201u;
+constexpr size_t kHgtSamples1 = 3601u;
+
+// key of the points out of the degrees range or not finite, they have no tile
+constexpr int32_t kNoTileKey = std::numeric_limits<int32_t>::min();
+
+double HgtSample(const uint8_t* data_ptr, const size_t samples, const size_t row, const size_t column) {
+  const uint8_t* sample_ptr = data_ptr + (row * samples + column) * 2u;
+  const int16_t value = static_cast<int16_t>((sample_ptr[0] << 8) | sample_ptr[1]);
+  return value == kHgtVoid ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(value);
+}
+
+// N45E006.hgt - south-west corner of the tile
+std::string HgtName(const int32_t latitude, const int32_t longitude) {
+  return fmt::format("{}{:02}{}{:03}.hgt", latitude < 0 ? 'S' : 'N', std::abs(latitude), longitude < 0 ? 'W' : 'E', std::abs(longitude));
+}
+
+}  // namespace
+
+DemTiles::DemTiles(std::filesystem::path directory, const size_t max_tiles)
+    : directory_(std::move(directory)), max_tiles_(std::max<size_t>(1u, max_tiles)) {}
+
+const DemTiles::Tile* DemTiles::GetTile(const int32_t latitude, const int32_t longitude) {
+  const TileKey key = MakeKey(latitude, longitude);
+  const auto found = index_.find(key);
+  if (found != index_.end()) {
+    tiles_.splice(tiles_.begin(), tiles_, found->second);
+    return tiles_.front().second.file ? &tiles_.front().second : nullptr;
+  }
+
+  Tile tile;
+  const std::filesystem::path path = directory_ / HgtName(latitude, longitude);
+  std::error_code error;
+  if (std::filesystem::is_regular_file(path, error)) {
+    try {
+      auto file = std::make_unique<MappedFile>(path);
+      for (const size_t samples : {kHgtSamples3, kHgtSamples1}) {
+        if (file->GetSize() == samples * samples * 2u) {
+          tile.samples = samples;
+          tile.file = std::move(file);
+          break;
+        }
+      }
+      if (!tile.file) {
+        SPDLOG_WARN("elevation tile {} has unknown size", path.string());
+      }
+    } catch (const std::system_error& e) {
+      SPDLOG_WARN("elevation tile {} can not be mapped: {}", path.string(), e.what());
+    }
+  }
+
+  if (tiles_.size() >= max_tiles_) {
+    index_.erase(tiles_.back().first);
+    tiles_.pop_back();
+  }
+  tiles_.emplace_front(key, std::move(tile));
+  index_[key] = tiles_.begin();
+  return tiles_.front().second.file ? &tiles_.front().second : nullptr;
+}
+
+void DemTiles::Elevations(const double* latitudes_ptr, const double* longitudes_ptr, const size_t count, double* elevations_ptr) {
+  // points of one tile are processed together, so every tile is looked up and paged in once
+  std::vector<TileKey> keys(count);
+  for (size_t index = 0u; index < count; ++index) {
+    // NaN is never in range, the degrees are checked before they are cast
+    const bool in_range = std::abs(latitudes_ptr[index]) <= 90.0 && std::abs(longitudes_ptr[index]) <= 180.0;
+    keys[index] = in_range ? MakeKey(static_cast<int32_t>(std::floor(latitudes_ptr[index])), static_cast<int32_t>(std::floor(longitudes_ptr[index])))
+                           : kNoTileKey;
+  }
+  std::vector<size_t> order(count);
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(), [&keys](const size_t left, const size_t right) { return keys[left] < keys[right]; });
+
+  size_t group_begin = 0u;
+  while (group_begin < count) {
+    size_t group_end = group_begin + 1u;
+    while (group_end < count && keys[order[group_end]] == keys[order[group_begin]]) {
+      ++group_end;
+    }
+    const size_t first = order[group_begin];
+    const bool has_tile = keys[first] != kNoTileKey;
+    const int32_t tile_latitude = has_tile ? static_cast<int32_t>(std::floor(latitudes_ptr[first])) : 0;
+    const int32_t tile_longitude = has_tile ? static_cast<int32_t>(std::floor(longitudes_ptr[first])) : 0;
+    const Tile* tile_ptr = has_tile ? GetTile(tile_latitude, tile_longitude) : nullptr;
+    for (size_t position = group_begin; position < group_end; ++position) {
+      const size_t index = order[position];
+      if (tile_ptr == nullptr) {
+        elevations_ptr[index] = std::numeric_limits<double>::quiet_NaN();
+        continue;
+      }
+      // row 0 is the north edge
+      const double cells = static_cast<double>(tile_ptr->samples - 1u);
+      const double row = (static_cast<double>(tile_latitude + 1) - latitudes_ptr[index]) * cells;
+      const double column = (longitudes_ptr[index] - static_cast<double>(tile_longitude)) * cells;
+      const size_t row0 = std::min(static_cast<size_t>(row), tile_ptr->samples - 2u);
+      const size_t column0 = std::min(static_cast<size_t>(column), tile_ptr->samples - 2u);
+      const double row_fraction = row - static_cast<double>(row0);
+      const double column_fraction = column - static_cast<double>(column0);
+      const uint8_t* data_ptr = tile_ptr->file->GetData();
+      const double north_west = HgtSample(data_ptr, tile_ptr->samples, row0, column0);
+      const double north_east = HgtSample(data_ptr, tile_ptr->samples, row0, column0 + 1u);
+      const double south_west = HgtSample(data_ptr, tile_ptr->samples, row0 + 1u, column0);
+      const double south_east = HgtSample(data_ptr, tile_ptr->samples, row0 + 1u, column0 + 1u);
+      const double north = north_west + (north_east - north_west) * column_fraction;
+      const double south = south_west + (south_east - south_west) * column_fraction;
+      // a void in any corner gives NaN
+      elevations_ptr[index] = north + (south - north) * row_fraction;
+    }
+    group_begin = group_end;
+  }
+}
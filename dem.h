@@ -0,0 +1,65 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "mapped_file.h"
+
+// SRTM/Copernicus .hgt elevation tiles from a local directory, mapped on demand and kept in an LRU cache
+class DemTiles {
+ public:
+  explicit DemTiles(std::filesystem::path directory, const size_t max_tiles = kDefaultMaxTiles);
+
+  // meters above sea level by degrees, NaN where there is no tile or the tile has a void
+  void Elevations(const double* latitudes_ptr, const double* longitudes_ptr, const size_t count, double* elevations_ptr);
+
+  size_t GetCachedTiles() const noexcept { return tiles_.size(); }
+
+  static constexpr size_t kDefaultMaxTiles = 16u;
+
+ private:
+  // one degree tile, big-endian int16 samples from north-west, rows go south
+  struct Tile {
+    std::unique_ptr<MappedFile> file;
+    size_t samples{0u};
+  };
+
+  using TileKey = int32_t;
+
+  static TileKey MakeKey(const int32_t latitude, const int32_t longitude) noexcept { return latitude * 1000 + longitude; }
+
+  // nullptr if the tile is absent or broken
+  const Tile* GetTile(const int32_t latitude, const int32_t longitude);
+
+  std::filesystem::path directory_;
+  size_t max_tiles_{kDefaultMaxTiles};
+  // most recently used first, absent tiles are cached too so the directory is not checked again
+  std::list<std::pair<TileKey, Tile>> tiles_;
+  std::unordered_map<TileKey, std::list<std::pair<TileKey, Tile>>::iterator> index_;
+};
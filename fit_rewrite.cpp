@@ -0,0 +1,386 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "fit_rewrite.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fitsdk/fit.h"
+#include "kernels.h"
+
+namespace {
+
+constexpr size_t kFitHeaderMinSize = 12u;
+constexpr size_t kFitHeaderSize = 14u;
+constexpr size_t kFitCrcSize = 2u;
+constexpr size_t kLocalMessages = 16u;
+// local messages of the compressed timestamp header
+constexpr size_t kCompressedLocalMessages = 4u;
+// definition: header, reserved, architecture, global message number (2), number of fields, fields of 3 bytes
+constexpr size_t kDefinitionFixedSize = 6u;
+constexpr size_t kFieldDefinitionSize = 3u;
+constexpr uint8_t kDefinitionHeader = 0x40u;
+constexpr uint8_t kDeveloperHeader = 0x20u;
+constexpr uint8_t kCompressedHeader = 0x80u;
+constexpr uint8_t kLocalMask = 0x0Fu;
+constexpr uint8_t kCompressedLocalMask = 0x03u;
+constexpr uint8_t kTimeOffsetMask = 0x1Fu;
+constexpr uint8_t kTimestampField = 253u;
+constexpr uint8_t kTimestampSize = 4u;
+constexpr uint8_t kTimestampBaseType = 0x86u;
+constexpr uint16_t kRecordMessage = 20u;
+constexpr uint32_t kTimestampInvalid = 0xFFFFFFFFu;
+constexpr size_t kNoOffset = std::numeric_limits<size_t>::max();
+constexpr int64_t kNoTimestamp = -1;
+
+uint32_t ReadUint32(const uint8_t* data_ptr, const bool big_endian) {
+  if (big_endian) {
+    return (static_cast<uint32_t>(data_ptr[0]) << 24u) | (static_cast<uint32_t>(data_ptr[1]) << 16u) |
+           (static_cast<uint32_t>(data_ptr[2]) << 8u) | static_cast<uint32_t>(data_ptr[3]);
+  }
+  return static_cast<uint32_t>(data_ptr[0]) | (static_cast<uint32_t>(data_ptr[1]) << 8u) | (static_cast<uint32_t>(data_ptr[2]) << 16u) |
+         (static_cast<uint32_t>(data_ptr[3]) << 24u);
+}
+
+void AppendUint32(std::string& data, const uint32_t value, const bool big_endian) {
+  for (size_t index = 0u; index < 4u; ++index) {
+    const size_t shift = big_endian ? (3u - index) * 8u : index * 8u;
+    data.push_back(static_cast<char>((value >> shift) & 0xFFu));
+  }
+}
+
+// definition of a local message as it is in the input
+struct Definition {
+  // whole definition message, empty if the local message is not defined
+  std::string_view bytes;
+  // data of a message without the header byte, developer fields included
+  size_t data_size{0u};
+  size_t timestamp_offset{kNoOffset};
+  // the definition without the timestamp field for the compressed timestamp header
+  std::string compressed_bytes;
+  bool big_endian{false};
+  // the profile has the timestamp of the message, only these messages set the reference of compressed timestamps in the SDK
+  bool profile_timestamp{false};
+  uint16_t global{0u};
+};
+
+// data message of the input, the timestamp is the field or resolved from the compressed header
+struct Message {
+  // header of the chained file of the message
+  const uint8_t* file_header;
+  const Definition* definition;
+  // header byte and data
+  std::string_view bytes;
+  uint8_t local;
+  bool compressed;
+  int64_t timestamp;
+};
+
+// false if the definition does not fit into the data
+bool ParseDefinition(const uint8_t* message_ptr, const size_t available, Definition& definition) {
+  if (available < kDefinitionFixedSize) {
+    return false;
+  }
+  const size_t fields = message_ptr[5];
+  size_t size = kDefinitionFixedSize + fields * kFieldDefinitionSize;
+  const bool developer = (message_ptr[0] & kDeveloperHeader) != 0u;
+  if (developer) {
+    if (available < size + 1u) {
+      return false;
+    }
+    size += 1u + message_ptr[size] * kFieldDefinitionSize;
+  }
+  if (available < size) {
+    return false;
+  }
+  definition = Definition{};
+  definition.bytes = std::string_view(reinterpret_cast<const char*>(message_ptr), size);
+  definition.big_endian = message_ptr[2] != 0u;
+  definition.global = definition.big_endian ? static_cast<uint16_t>((message_ptr[3] << 8u) | message_ptr[4])
+                                            : static_cast<uint16_t>(message_ptr[3] | (message_ptr[4] << 8u));
+  const FIT_MESG_DEF* profile_ptr = Fit_GetMesgDef(definition.global);
+  definition.profile_timestamp = profile_ptr != nullptr && Fit_GetFieldOffset(profile_ptr, kTimestampField) != FIT_UINT16_INVALID;
+  const uint8_t* field_ptr = message_ptr + kDefinitionFixedSize;
+  for (size_t field = 0u; field < fields; ++field, field_ptr += kFieldDefinitionSize) {
+    if (field_ptr[0] == kTimestampField && field_ptr[1] == kTimestampSize && field_ptr[2] == kTimestampBaseType) {
+      definition.timestamp_offset = definition.data_size;
+      definition.compressed_bytes.assign(definition.bytes);
+      definition.compressed_bytes.erase(kDefinitionFixedSize + field * kFieldDefinitionSize, kFieldDefinitionSize);
+      definition.compressed_bytes[5] = static_cast<char>(fields - 1u);
+    }
+    definition.data_size += field_ptr[1];
+  }
+  if (developer) {
+    const size_t developer_fields = *field_ptr++;
+    for (size_t field = 0u; field < developer_fields; ++field, field_ptr += kFieldDefinitionSize) {
+      definition.data_size += field_ptr[1];
+    }
+  }
+  return true;
+}
+
+// calls on_message for every data message of the chained files without decoding the fields, false if the data is not .fit or is cut
+template <typename OnMessage>
+bool ForEachMessage(const uint8_t* data_ptr, const size_t size, OnMessage&& on_message) {
+  size_t files = 0u;
+  size_t position = 0u;
+  while (size - position >= kFitHeaderMinSize) {
+    const uint8_t* header_ptr = data_ptr + position;
+    const size_t header_size = header_ptr[0];
+    if (header_size < kFitHeaderMinSize || std::memcmp(header_ptr + 8u, ".FIT", 4u) != 0) {
+      break;
+    }
+    const size_t data_size = ReadUint32(header_ptr + 4u, false);
+    if (header_size + data_size + kFitCrcSize > size - position) {
+      return false;
+    }
+    // every file has its own definitions and the reference of compressed timestamps starts at 0 like in the SDK
+    std::array<Definition, kLocalMessages> definitions;
+    int64_t timestamp = 0;
+    const uint8_t* message_ptr = header_ptr + header_size;
+    const uint8_t* end_ptr = message_ptr + data_size;
+    while (message_ptr < end_ptr) {
+      const uint8_t header = *message_ptr;
+      const size_t available = static_cast<size_t>(end_ptr - message_ptr);
+      const bool compressed = (header & kCompressedHeader) != 0u;
+      if (!compressed && (header & kDefinitionHeader) != 0u) {
+        if (!ParseDefinition(message_ptr, available, definitions[header & kLocalMask])) {
+          return false;
+        }
+        message_ptr += definitions[header & kLocalMask].bytes.size();
+        continue;
+      }
+      const uint8_t local = compressed ? ((header >> 5u) & kCompressedLocalMask) : (header & kLocalMask);
+      const Definition& definition = definitions[local];
+      if (definition.bytes.empty() || available < 1u + definition.data_size) {
+        return false;
+      }
+      int64_t message_timestamp = kNoTimestamp;
+      if (compressed) {
+        timestamp += ((header & kTimeOffsetMask) - timestamp) & kTimeOffsetMask;
+        message_timestamp = timestamp;
+      } else if (definition.timestamp_offset != kNoOffset) {
+        const uint32_t value = ReadUint32(message_ptr + 1u + definition.timestamp_offset, definition.big_endian);
+        if (value != kTimestampInvalid) {
+          message_timestamp = value;
+          if (definition.profile_timestamp) {
+            timestamp = value;
+          }
+        }
+      }
+      on_message(Message{header_ptr, &definition, std::string_view(reinterpret_cast<const char*>(message_ptr), 1u + definition.data_size), local,
+                         compressed, message_timestamp});
+      message_ptr += 1u + definition.data_size;
+    }
+    position += header_size + data_size + kFitCrcSize;
+    ++files;
+  }
+  return files > 0u;
+}
+
+// chained files of the output, a definition is written only when no local message of the output file has it.
+// compact moves the timestamp fields to compressed timestamp headers where the time from the previous timestamp fits
+class FitWriter {
+ public:
+  FitWriter(const uint8_t* input_header_ptr, const bool compact) : compact_(compact) { StartFile(input_header_ptr); }
+
+  void Write(const Message& message) {
+    if (message.file_header != file_header_) {
+      if (data_.size() > file_start_ + kFitHeaderSize) {
+        FinishFile();
+      } else {
+        data_.resize(file_start_);
+      }
+      StartFile(message.file_header);
+    }
+    const Definition& definition = *message.definition;
+    const std::string_view fields = message.bytes.substr(1u);
+    const bool in_range = timestamp_ != kNoTimestamp && message.timestamp >= timestamp_ && message.timestamp - timestamp_ <= kTimeOffsetMask;
+    if (message.compressed && (in_range || static_cast<uint8_t>(definition.bytes[5]) == std::numeric_limits<uint8_t>::max())) {
+      WriteCompressed(definition.bytes, message.timestamp);
+      data_.append(fields);
+    } else if (message.compressed) {
+      // the reference is cut off: normal header and the timestamp as the first field
+      std::string timestamp_definition(definition.bytes);
+      timestamp_definition[5] = static_cast<char>(static_cast<uint8_t>(timestamp_definition[5]) + 1u);
+      timestamp_definition.insert(kDefinitionFixedSize, {static_cast<char>(kTimestampField), static_cast<char>(kTimestampSize),
+                                                         static_cast<char>(kTimestampBaseType)});
+      data_.push_back(static_cast<char>(Define(timestamp_definition, kLocalMessages)));
+      AppendUint32(data_, static_cast<uint32_t>(message.timestamp), definition.big_endian);
+      data_.append(fields);
+      timestamp_ = definition.profile_timestamp ? message.timestamp : kNoTimestamp;
+    } else if (compact_ && in_range && definition.profile_timestamp) {
+      WriteCompressed(definition.compressed_bytes, message.timestamp);
+      data_.append(fields.substr(0u, definition.timestamp_offset));
+      data_.append(fields.substr(definition.timestamp_offset + kTimestampSize));
+    } else {
+      data_.push_back(static_cast<char>(Define(definition.bytes, kLocalMessages)));
+      data_.append(fields);
+      if (message.timestamp != kNoTimestamp) {
+        timestamp_ = definition.profile_timestamp ? message.timestamp : kNoTimestamp;
+      }
+    }
+  }
+
+  std::string Finish() {
+    FinishFile();
+    return std::move(data_);
+  }
+
+ private:
+  // header with protocol and profile versions of the input file
+  void StartFile(const uint8_t* input_header_ptr) {
+    file_header_ = input_header_ptr;
+    file_start_ = data_.size();
+    data_.append(kFitHeaderSize, '\0');
+    std::memcpy(data_.data() + file_start_ + 1u, input_header_ptr + 1u, 3u);
+    definitions_.fill(std::string());
+    uses_.fill(0u);
+    timestamp_ = kNoTimestamp;
+  }
+
+  // header and crc
+  void FinishFile() {
+    char* header_ptr = data_.data() + file_start_;
+    const uint32_t data_size = static_cast<uint32_t>(data_.size() - file_start_ - kFitHeaderSize);
+    header_ptr[0] = static_cast<char>(kFitHeaderSize);
+    for (size_t index = 0u; index < 4u; ++index) {
+      header_ptr[4u + index] = static_cast<char>((data_size >> (index * 8u)) & 0xFFu);
+    }
+    std::memcpy(header_ptr + 8u, ".FIT", 4u);
+    const uint16_t header_crc = FitCrc16(0u, reinterpret_cast<const uint8_t*>(header_ptr), kFitHeaderSize - kFitCrcSize);
+    header_ptr[12] = static_cast<char>(header_crc & 0xFFu);
+    header_ptr[13] = static_cast<char>(header_crc >> 8u);
+    const uint16_t crc = FitCrc16(0u, reinterpret_cast<const uint8_t*>(header_ptr), data_.size() - file_start_);
+    data_.push_back(static_cast<char>(crc & 0xFFu));
+    data_.push_back(static_cast<char>(crc >> 8u));
+  }
+
+  void WriteCompressed(const std::string_view definition, const int64_t timestamp) {
+    const uint8_t local = Define(definition, kCompressedLocalMessages);
+    data_.push_back(static_cast<char>(kCompressedHeader | (local << 5u) | (timestamp & kTimeOffsetMask)));
+    timestamp_ = timestamp;
+  }
+
+  // local message of the output with the definition among the first locals, the least recently used one is redefined
+  uint8_t Define(const std::string_view definition, const size_t locals) {
+    auto same = [&definition](const std::string& local_definition) {
+      return local_definition.size() == definition.size() &&
+             ((local_definition[0] ^ definition[0]) & static_cast<char>(~kLocalMask)) == 0 &&
+             std::memcmp(local_definition.data() + 1u, definition.data() + 1u, definition.size() - 1u) == 0;
+    };
+    size_t local = 0u;
+    while (local < locals && !same(definitions_[local])) {
+      ++local;
+    }
+    if (local == locals) {
+      local = static_cast<size_t>(std::min_element(uses_.begin(), uses_.begin() + locals) - uses_.begin());
+      definitions_[local].assign(definition);
+      definitions_[local][0] = static_cast<char>((static_cast<uint8_t>(definition[0]) & ~kLocalMask) | local);
+      data_.append(definitions_[local]);
+    }
+    uses_[local] = ++use_;
+    return static_cast<uint8_t>(local);
+  }
+
+  const bool compact_;
+  std::string data_;
+  const uint8_t* file_header_{nullptr};
+  size_t file_start_{0u};
+  std::array<std::string, kLocalMessages> definitions_;
+  // last use of the local messages, 0 is unused
+  std::array<uint64_t, kLocalMessages> uses_{};
+  uint64_t use_{0u};
+  // reference of the compressed timestamps in the output file
+  int64_t timestamp_{kNoTimestamp};
+};
+
+}  // namespace
+
+std::unique_ptr<FitResult> TrimFit(DataSource& data_source, const int64_t from_ms, const int64_t to_ms, const bool compact) {
+  auto result = std::make_unique<FitResult>(ParseResult::kError, rapidjson::StringBuffer());
+  const uint8_t* data_ptr = data_source.GetContiguousData();
+  size_t size = data_source.GetSize();
+  std::vector<uint8_t> data;
+  if (data_ptr == nullptr) {
+    Buffer buffer(4096u * 16u);
+    DataSource::Status status{DataSource::Status::kContinueRead};
+    while (status == DataSource::Status::kContinueRead) {
+      status = data_source.ReadData(buffer);
+      data.insert(data.end(), buffer.GetDataPtr(), buffer.GetDataPtr() + buffer.GetDataSize());
+    }
+    data_ptr = data.data();
+    size = data.size();
+  }
+
+  // the window starts at the first record, or at the first timestamp if there are no records
+  int64_t start = kNoTimestamp;
+  int64_t first = kNoTimestamp;
+  const bool parsed = ForEachMessage(data_ptr, size, [&](const Message& message) {
+    if (message.timestamp == kNoTimestamp) {
+      return;
+    }
+    if (first == kNoTimestamp) {
+      first = message.timestamp;
+    }
+    if (start == kNoTimestamp && message.definition->global == kRecordMessage) {
+      start = message.timestamp;
+    }
+  });
+  if (!parsed) {
+    SPDLOG_ERROR(".fit file can not be parsed");
+    return result;
+  }
+  if (start == kNoTimestamp) {
+    start = first;
+  }
+
+  auto in_window = [&](const int64_t timestamp) {
+    const int64_t offset_ms = (timestamp - start) * 1000;
+    return (from_ms <= 0 || offset_ms >= from_ms) && (to_ms < 0 || offset_ms <= to_ms);
+  };
+  FitWriter writer(data_ptr, compact);
+  size_t messages{0u};
+  int64_t last = kNoTimestamp;
+  ForEachMessage(data_ptr, size, [&](const Message& message) {
+    if (message.timestamp != kNoTimestamp) {
+      last = message.timestamp;
+    }
+    const bool before_end = last == kNoTimestamp || to_ms < 0 || (last - start) * 1000 <= to_ms;
+    if (message.timestamp != kNoTimestamp ? in_window(message.timestamp) : before_end) {
+      writer.Write(message);
+      ++messages;
+    }
+  });
+  const std::string file = writer.Finish();
+  std::memcpy(result->second.Push(file.size()), file.data(), file.size());
+  SPDLOG_INFO("{} message(s) are copied, {} bytes of {}", messages, file.size(), size);
+  result->first = ParseResult::kSuccess;
+  return result;
+}
@@ -0,0 +1,37 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "datasource.h"
+#include "parser.h"
+
+// .fit file of the messages from from_ms to to_ms after the first record, from_ms 0 is the beginning and negative to_ms is the end.
+// messages are copied as they are without decoding: a definition is written before the first message of the window that uses it,
+// a compressed timestamp which reference is cut off gets the timestamp as a field and the messages without a timestamp
+// (file id, developer fields) are kept up to the end of the window. chained files stay chained and local messages are renumbered
+// so that a definition is written again only when it was evicted by others.
+// compact moves the timestamp fields to compressed timestamp headers where the time from the previous timestamp is less than 32 s,
+// the file is decoded to the same messages
+std::unique_ptr<FitResult> TrimFit(DataSource& data_source, const int64_t from_ms, const int64_t to_ms, const bool compact);
@@ -0,0 +1,204 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "fitconvert.h"
+
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "datasource.h"
+#include "parser.h"
+
+struct fitconvert_converter {
+  std::string_view type{kOutputVttTag};
+  int64_t offset{0};
+  uint8_t smoothness{0u};
+  uint32_t datatypes{std::numeric_limits<uint32_t>::max()};
+  bool imperial{false};
+  uint32_t derive_data_types{DefaultDeriveDataTypes()};
+  std::string where;
+  int64_t where_pad_ms{0};
+  int64_t where_join_ms{0};
+  std::string cue_template;
+
+  std::vector<uint8_t> input;
+  std::unique_ptr<FitResult> result;
+};
+
+namespace {
+
+template <typename T>
+bool ParseNumber(const std::string_view text, T& value) {
+  const auto [end_ptr, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+  return error == std::errc() && end_ptr == text.data() + text.size();
+}
+
+fitconvert_status SetOption(fitconvert_converter& converter, const std::string_view name, const std::string_view value) {
+  if (name == "type") {
+    if (value != kOutputVttTag && value != kOutputJsonTag) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+    converter.type = value == kOutputVttTag ? kOutputVttTag : kOutputJsonTag;
+  } else if (name == "offset") {
+    if (!ParseNumber(value, converter.offset)) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+  } else if (name == "smoothness") {
+    uint32_t smoothness{0u};
+    if (!ParseNumber(value, smoothness) || smoothness > 5u) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+    converter.smoothness = static_cast<uint8_t>(smoothness);
+  } else if (name == "data") {
+    const uint32_t datatypes = DataTypeNamesToMask(value);
+    converter.datatypes = datatypes == 0u ? std::numeric_limits<uint32_t>::max() : datatypes;
+  } else if (name == "derive") {
+    if (!DeriveNamesToMask(value, converter.derive_data_types)) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+  } else if (name == "values") {
+    if (value != kValuesMetric && value != kValuesImperial) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+    converter.imperial = value == kValuesImperial;
+  } else if (name == "where") {
+    converter.where = value;
+  } else if (name == "pad") {
+    if (!ParseNumber(value, converter.where_pad_ms)) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+  } else if (name == "join") {
+    if (!ParseNumber(value, converter.where_join_ms)) {
+      return FITCONVERT_ERROR_ARGUMENT;
+    }
+  } else if (name == "template") {
+    converter.cue_template = value;
+  } else {
+    return FITCONVERT_ERROR_ARGUMENT;
+  }
+  return FITCONVERT_OK;
+}
+
+}  // namespace
+
+// nothing is thrown across the boundary
+extern "C" {
+
+uint32_t fitconvert_abi_version(void) {
+  return FITCONVERT_ABI_VERSION;
+}
+
+fitconvert_converter* fitconvert_create(void) {
+  try {
+    return new fitconvert_converter();
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void fitconvert_destroy(fitconvert_converter* converter) {
+  delete converter;
+}
+
+fitconvert_status fitconvert_set_option(fitconvert_converter* converter, const char* name, const char* value) {
+  if (converter == nullptr || name == nullptr || value == nullptr) {
+    return FITCONVERT_ERROR_ARGUMENT;
+  }
+  try {
+    return SetOption(*converter, name, value);
+  } catch (...) {
+    return FITCONVERT_ERROR_INTERNAL;
+  }
+}
+
+fitconvert_status fitconvert_feed(fitconvert_converter* converter, const uint8_t* data, size_t size) {
+  if (converter == nullptr || (data == nullptr && size > 0u)) {
+    return FITCONVERT_ERROR_ARGUMENT;
+  }
+  if (size == 0u) {
+    return FITCONVERT_OK;
+  }
+  uint8_t* buffer_ptr = fitconvert_feed_buffer(converter, size);
+  if (buffer_ptr == nullptr) {
+    return FITCONVERT_ERROR_INTERNAL;
+  }
+  std::memcpy(buffer_ptr, data, size);
+  return FITCONVERT_OK;
+}
+
+uint8_t* fitconvert_feed_buffer(fitconvert_converter* converter, size_t size) {
+  if (converter == nullptr) {
+    return nullptr;
+  }
+  try {
+    converter->result.reset();
+    const size_t position = converter->input.size();
+    converter->input.resize(position + size);
+    return converter->input.data() + position;
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+fitconvert_status fitconvert_convert(fitconvert_converter* converter) {
+  if (converter == nullptr) {
+    return FITCONVERT_ERROR_ARGUMENT;
+  }
+  try {
+    converter->result.reset();
+    std::vector<std::unique_ptr<DataSource>> data_sources;
+    // the input is decoded in place
+    data_sources.push_back(std::make_unique<DataSourceMemory>(converter->input.data(), converter->input.size()));
+    ConvertOptions options;
+    options.derive_data_types = converter->derive_data_types;
+    options.where = converter->where;
+    options.where_pad_ms = converter->where_pad_ms;
+    options.where_join_ms = converter->where_join_ms;
+    options.cue_template = converter->cue_template;
+    converter->result = Convert(std::move(data_sources), converter->type, converter->offset, converter->smoothness, converter->datatypes,
+                                converter->imperial, std::move(options));
+    return converter->result->first == ParseResult::kSuccess ? FITCONVERT_OK : FITCONVERT_ERROR_DECODE;
+  } catch (...) {
+    return FITCONVERT_ERROR_INTERNAL;
+  }
+}
+
+fitconvert_status fitconvert_output(const fitconvert_converter* converter, const uint8_t** data, size_t* size) {
+  if (converter == nullptr || data == nullptr || size == nullptr || !converter->result || converter->result->first != ParseResult::kSuccess) {
+    return FITCONVERT_ERROR_ARGUMENT;
+  }
+  *data = reinterpret_cast<const uint8_t*>(converter->result->second.GetString());
+  *size = converter->result->second.GetSize();
+  return FITCONVERT_OK;
+}
+
+void fitconvert_reset(fitconvert_converter* converter) {
+  if (converter != nullptr) {
+    converter->input.clear();
+    converter->result.reset();
+  }
+}
+}
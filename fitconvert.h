@@ -0,0 +1,93 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+// C interface of libfitconvert for embedding the converter in other languages.
+//
+// Thread safety: a converter is not synchronized, calls on one converter must not overlap, it can be passed between threads
+// between calls. Different converters are independent and can be used concurrently. A converter keeps its buffers between
+// conversions, so one converter per worker can be kept for the life of a service.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(FITCONVERT_BUILD_LIBRARY)
+#define FITCONVERT_API __declspec(dllexport)
+#else
+#define FITCONVERT_API __declspec(dllimport)
+#endif
+#else
+#define FITCONVERT_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// changes only when a function or a meaning of a value changes
+#define FITCONVERT_ABI_VERSION 1
+
+typedef struct fitconvert_converter fitconvert_converter;
+
+typedef enum fitconvert_status {
+  FITCONVERT_OK = 0,
+  // the fed bytes are not a .fit file or it is broken
+  FITCONVERT_ERROR_DECODE = 1,
+  // unknown option, value out of range or a null pointer
+  FITCONVERT_ERROR_ARGUMENT = 2,
+  // out of memory or another failure inside the converter
+  FITCONVERT_ERROR_INTERNAL = 3,
+} fitconvert_status;
+
+FITCONVERT_API uint32_t fitconvert_abi_version(void);
+
+// a converter with the defaults of the command line tool: vtt, metric, no offset and smoothing, null when out of memory
+FITCONVERT_API fitconvert_converter* fitconvert_create(void);
+
+FITCONVERT_API void fitconvert_destroy(fitconvert_converter* converter);
+
+// options by the long names of the command line tool, values are copied:
+// "type" vtt or json, "offset" milliseconds, "smoothness" 0-5, "data" and "derive" names of the data types divided by comma
+// ("derive" is speed,distance by default, none computes nothing),
+// "values" metric or imperial, "where" filter expression, "pad" and "join" milliseconds, "template" vtt cue text
+FITCONVERT_API fitconvert_status fitconvert_set_option(fitconvert_converter* converter, const char* name, const char* value);
+
+// appends bytes of the .fit input, chained .fit files can be fed as one stream
+FITCONVERT_API fitconvert_status fitconvert_feed(fitconvert_converter* converter, const uint8_t* data, size_t size);
+
+// appends size bytes to the input and returns them to be filled in place (e.g. by a read from a socket), null when out of
+// memory, valid until the next call on the converter
+FITCONVERT_API uint8_t* fitconvert_feed_buffer(fitconvert_converter* converter, size_t size);
+
+// converts the fed input, the output of the previous conversion is released
+FITCONVERT_API fitconvert_status fitconvert_convert(fitconvert_converter* converter);
+
+// output of the last conversion owned by the converter, valid until the next feed, convert, reset or destroy
+FITCONVERT_API fitconvert_status fitconvert_output(const fitconvert_converter* converter, const uint8_t** data, size_t* size);
+
+// drops the input and the output for the next conversion, options and the allocated input buffer are kept
+FITCONVERT_API void fitconvert_reset(fitconvert_converter* converter);
+
+#ifdef __cplusplus
+}
+#endif
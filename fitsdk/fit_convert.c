@@ -31,6 +31,77 @@
    #define state  (&state_struct)
 #endif
 
+#if defined(_MSC_VER)
+   #include <stdlib.h>
+   #define FIT_BSWAP16(x) _byteswap_ushort(x)
+   #define FIT_BSWAP32(x) _byteswap_ulong(x)
+   #define FIT_BSWAP64(x) _byteswap_uint64(x)
+#elif defined(__GNUC__) || defined(__clang__)
+   #define FIT_BSWAP16(x) __builtin_bswap16(x)
+   #define FIT_BSWAP32(x) __builtin_bswap32(x)
+   #define FIT_BSWAP64(x) __builtin_bswap64(x)
+#else
+   #define FIT_BSWAP16(x) ((FIT_UINT16)(((x) >> 8) | ((x) << 8)))
+   #define FIT_BSWAP32(x) ((((x) >> 24) & 0xFFu) | (((x) >> 8) & 0xFF00u) | (((x) << 8) & 0xFF0000u) | ((x) << 24))
+   #define FIT_BSWAP64(x) (((FIT_UINT64)FIT_BSWAP32((FIT_UINT32)(x)) << 32) | FIT_BSWAP32((FIT_UINT32)((x) >> 32)))
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+//////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////
+// Swaps all fields of the decoded message at once, the loops are
+// simple enough to be vectorized for array fields.
+///////////////////////////////////////////////////////////////////////
+static void FitConvert_SwapFields(FIT_UINT8 *mesg, const FIT_CONVERT_SWAP_FIELD *swap_fields, FIT_UINT8 num_swap_fields)
+{
+   FIT_UINT8 swap_index;
+
+   for (swap_index = 0; swap_index < num_swap_fields; swap_index++)
+   {
+      FIT_UINT8 *field = &mesg[swap_fields[swap_index].offset];
+      FIT_UINT8 elements = swap_fields[swap_index].size / swap_fields[swap_index].type_size;
+      FIT_UINT8 element;
+
+      switch (swap_fields[swap_index].type_size)
+      {
+         case 2:
+            for (element = 0; element < elements; element++)
+            {
+               FIT_UINT16 value;
+               memcpy(&value, field + element * 2, sizeof(value));
+               value = FIT_BSWAP16(value);
+               memcpy(field + element * 2, &value, sizeof(value));
+            }
+            break;
+
+         case 4:
+            for (element = 0; element < elements; element++)
+            {
+               FIT_UINT32 value;
+               memcpy(&value, field + element * 4, sizeof(value));
+               value = FIT_BSWAP32(value);
+               memcpy(field + element * 4, &value, sizeof(value));
+            }
+            break;
+
+         case 8:
+            for (element = 0; element < elements; element++)
+            {
+               FIT_UINT64 value;
+               memcpy(&value, field + element * 8, sizeof(value));
+               value = FIT_BSWAP64(value);
+               memcpy(field + element * 8, &value, sizeof(value));
+            }
+            break;
+
+         default:
+            break;
+      }
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 //////////////////////////////////////////////////////////////////////////////////
@@ -42,9 +113,24 @@
    void FitConvert_Init(FIT_BOOL read_file_header)
 #endif
 {
-   state->mesg_offset = 0;
    state->data_offset = 0;
 
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   FitConvert_InitNext(state, read_file_header);
+#else
+   FitConvert_InitNext(read_file_header);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   void FitConvert_InitNext(FIT_CONVERT_STATE *state, FIT_BOOL read_file_header)
+#else
+   void FitConvert_InitNext(FIT_BOOL read_file_header)
+#endif
+{
+   state->mesg_offset = 0;
+
 #if defined(FIT_CONVERT_CHECK_CRC)
    state->crc = 0;
 #endif
@@ -188,6 +274,7 @@
 
                   state->mesg_sizes[state->mesg_index] = 0;
                   state->dev_data_sizes[state->mesg_index] = 0;
+                  state->num_dev_fields[state->mesg_index] = 0;
                   state->decode_state = FIT_CONVERT_DECODE_RESERVED1;
                }
             }
@@ -211,12 +298,16 @@
                }
 
                if (state->mesg_sizes[state->mesg_index] == 0)
-                  state->decode_state = FIT_CONVERT_DECODE_RECORD;
+               {
+                  state->decode_state = (state->dev_data_sizes[state->mesg_index] > 0) ?
+                     FIT_CONVERT_DECODE_DEV_FIELD_DATA : FIT_CONVERT_DECODE_RECORD;
+               }
             }
 
             state->mesg_offset = 0; // Reset the message byte count.
             state->field_index = 0;
             state->field_offset = 0;
+            state->dev_data_offset = 0;
             break;
 
          case FIT_CONVERT_DECODE_RESERVED1:
@@ -254,6 +345,7 @@
                }
 
                state->convert_table[state->mesg_index].num_fields = 0; // Initialize.
+               state->num_swap_fields[state->mesg_index] = 0;
                state->mesg_def = Fit_GetMesgDef(state->convert_table[state->mesg_index].global_mesg_num);
             }
 
@@ -336,8 +428,28 @@
          case FIT_CONVERT_DECODE_FIELD_BASE_TYPE:
             if (state->field_num != FIT_FIELD_NUM_INVALID)
             {
-               state->convert_table[state->mesg_index].fields[state->convert_table[state->mesg_index].num_fields].base_type = datum;
+               FIT_FIELD_CONVERT *field = &state->convert_table[state->mesg_index].fields[state->convert_table[state->mesg_index].num_fields];
+
+               field->base_type = datum;
                state->convert_table[state->mesg_index].num_fields++;
+
+               // Pre-compute the fields to swap once per definition instead of checking every field of every message.
+               if (
+                     (datum & FIT_BASE_TYPE_ENDIAN_FLAG) &&
+                     ((state->convert_table[state->mesg_index].arch & FIT_ARCH_ENDIAN_MASK) != (Fit_GetArch() & FIT_ARCH_ENDIAN_MASK))
+                  )
+               {
+                  FIT_UINT8 index = datum & FIT_BASE_TYPE_NUM_MASK;
+                  FIT_CONVERT_SWAP_FIELD *swap_field = &state->swap_fields[state->mesg_index][state->num_swap_fields[state->mesg_index]];
+
+                  if (index >= FIT_BASE_TYPES)
+                     return FIT_CONVERT_ERROR;
+
+                  swap_field->offset = field->offset_local;
+                  swap_field->size = field->size;
+                  swap_field->type_size = fit_base_type_sizes[index];
+                  state->num_swap_fields[state->mesg_index]++;
+               }
             }
 
             state->field_index++;
@@ -367,17 +479,38 @@
             break;
 
          case FIT_CONVERT_DECODE_DEV_FIELD_DEF:
-            // Doesn't matter yet
+            state->field_num = datum;
             state->decode_state = FIT_CONVERT_DECODE_DEV_FIELD_SIZE;
             break;
 
          case FIT_CONVERT_DECODE_DEV_FIELD_SIZE:
-            // Just keep track of the amount of data that we need to ignore
+            if (state->num_dev_fields[state->mesg_index] < FIT_CONVERT_DEV_FIELDS)
+            {
+               FIT_CONVERT_DEV_FIELD *dev_field = &state->dev_fields[state->mesg_index][state->num_dev_fields[state->mesg_index]];
+
+               dev_field->num = state->field_num;
+               dev_field->size = datum;
+               dev_field->offset = state->dev_data_sizes[state->mesg_index];
+            }
+
+            // Keep track of the amount of data to read after the fields
             state->dev_data_sizes[state->mesg_index] += datum;
             state->decode_state = FIT_CONVERT_DECODE_DEV_FIELD_INDEX;
             break;
 
          case FIT_CONVERT_DECODE_DEV_FIELD_INDEX:
+            if (state->num_dev_fields[state->mesg_index] < FIT_CONVERT_DEV_FIELDS)
+            {
+               FIT_CONVERT_DEV_FIELD *dev_field = &state->dev_fields[state->mesg_index][state->num_dev_fields[state->mesg_index]];
+
+               // Fields that do not fit into the developer data buffer are skipped
+               if ((dev_field->size > 0) && ((FIT_UINT16)(dev_field->offset + dev_field->size) <= FIT_CONVERT_DEV_DATA_SIZE))
+               {
+                  dev_field->developer_data_index = datum;
+                  state->num_dev_fields[state->mesg_index]++;
+               }
+            }
+
             // Increment the number of fields that we have read
             state->field_index++;
 
@@ -416,35 +549,6 @@
 
                      if (state->field_offset >= state->convert_table[state->mesg_index].fields[state->field_index].size)
                      {
-                        if (
-                              (state->convert_table[state->mesg_index].fields[state->field_index].base_type & FIT_BASE_TYPE_ENDIAN_FLAG) &&
-                              ((state->convert_table[state->mesg_index].arch & FIT_ARCH_ENDIAN_MASK) != (Fit_GetArch() & FIT_ARCH_ENDIAN_MASK))
-                           )
-                        {
-                           FIT_UINT8 type_size;
-                           FIT_UINT8 element_size;
-                           FIT_UINT8 element;
-                           FIT_UINT8 index;
-
-                           index = state->convert_table[state->mesg_index].fields[state->field_index].base_type & FIT_BASE_TYPE_NUM_MASK;
-
-                           if (index >= FIT_BASE_TYPES)
-                              return FIT_CONVERT_ERROR;
-
-                           type_size = fit_base_type_sizes[index];
-                           element_size = state->convert_table[state->mesg_index].fields[state->field_index].size / type_size;
-
-                           for (element = 0; element < element_size; element++)
-                           {
-                              for (index = 0; index < (type_size / 2); index++)
-                              {
-                                 FIT_UINT8 tmp = field[element * type_size + index];
-                                 field[element * type_size + index] = field[element * type_size + type_size - 1 - index];
-                                 field[element * type_size + type_size - 1 - index] = tmp;
-                              }
-                           }
-                        }
-
                         // Null terminate last character if multi-byte beyond end of field.
                         if (state->convert_table[state->mesg_index].fields[state->field_index].base_type == FIT_BASE_TYPE_STRING)
                         {
@@ -489,6 +593,9 @@
 
                         if (state->field_index >= state->convert_table[state->mesg_index].num_fields)
                         {
+                           if (state->num_swap_fields[state->mesg_index] > 0)
+                              FitConvert_SwapFields(state->u.mesg, state->swap_fields[state->mesg_index], state->num_swap_fields[state->mesg_index]);
+
                            #if defined(FIT_CONVERT_TIME_RECORD)
                               {
                                  FIT_UINT16 timestamp_offset = Fit_GetFieldOffset(state->mesg_def, FIT_FIELD_NUM_TIMESTAMP);
@@ -518,8 +625,11 @@
             break;
 
          case FIT_CONVERT_DECODE_DEV_FIELD_DATA:
-            state->field_offset++;
-            if (state->field_offset >= state->dev_data_sizes[state->mesg_index])
+            if (state->dev_data_offset < FIT_CONVERT_DEV_DATA_SIZE)
+               state->dev_data[state->dev_data_offset] = datum;
+
+            state->dev_data_offset++;
+            if (state->dev_data_offset >= state->dev_data_sizes[state->mesg_index])
             {
                // Done Parsing Dev Field Data
                state->decode_state = FIT_CONVERT_DECODE_RECORD;
@@ -617,3 +727,34 @@
 
     return state->convert_table[state->mesg_index].fields[field_index].size;
 }
+
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   const FIT_CONVERT_DEV_FIELD *FitConvert_GetDevFields(FIT_CONVERT_STATE *state, FIT_UINT8 *num_dev_fields)
+#else
+   const FIT_CONVERT_DEV_FIELD *FitConvert_GetDevFields(FIT_UINT8 *num_dev_fields)
+#endif
+{
+   *num_dev_fields = state->num_dev_fields[state->mesg_index];
+   return state->dev_fields[state->mesg_index];
+}
+
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   const FIT_UINT8 *FitConvert_GetDevData(FIT_CONVERT_STATE *state)
+#else
+   const FIT_UINT8 *FitConvert_GetDevData(void)
+#endif
+{
+   return state->dev_data;
+}
+
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   FIT_UINT8 FitConvert_GetMessageArch(FIT_CONVERT_STATE *state)
+#else
+   FIT_UINT8 FitConvert_GetMessageArch(void)
+#endif
+{
+   return state->convert_table[state->mesg_index].arch;
+}
@@ -58,6 +58,32 @@ typedef enum
    FIT_CONVERT_DECODE_DEV_FIELD_DATA
 } FIT_CONVERT_DECODE_STATE;
 
+#if !defined(FIT_CONVERT_DEV_FIELDS)
+   #define FIT_CONVERT_DEV_FIELDS      16  // Maximum number of developer fields kept per local message.
+#endif
+#if !defined(FIT_CONVERT_DEV_DATA_SIZE)
+   #define FIT_CONVERT_DEV_DATA_SIZE   256 // Developer data bytes kept per message, fields beyond are skipped.
+#endif
+
+// Developer field of a local message definition. Offset is from the start of the message developer data.
+typedef struct
+{
+   FIT_UINT16 offset;
+   FIT_UINT8 num;
+   FIT_UINT8 size;
+   FIT_UINT8 developer_data_index;
+} FIT_CONVERT_DEV_FIELD;
+
+#define FIT_CONVERT_SWAP_FIELDS (sizeof(((FIT_MESG_CONVERT *)0)->fields) / sizeof(FIT_FIELD_CONVERT))
+
+// Field of a local message definition that has the byte order opposite to the build architecture.
+typedef struct
+{
+   FIT_UINT16 offset;
+   FIT_UINT8 size;
+   FIT_UINT8 type_size;
+} FIT_CONVERT_SWAP_FIELD;
+
 typedef struct
 {
    FIT_UINT32 file_bytes_left;
@@ -71,6 +97,8 @@ typedef struct
       FIT_UINT8 mesg[FIT_MESG_SIZE];
    }u;
    FIT_MESG_CONVERT convert_table[FIT_LOCAL_MESGS];
+   FIT_CONVERT_SWAP_FIELD swap_fields[FIT_LOCAL_MESGS][FIT_CONVERT_SWAP_FIELDS];
+   FIT_UINT8 num_swap_fields[FIT_LOCAL_MESGS];
    const FIT_MESG_DEF *mesg_def;
    #if defined(FIT_CONVERT_CHECK_CRC)
       FIT_UINT16 crc;
@@ -79,7 +107,11 @@ typedef struct
    FIT_BOOL has_dev_data;
    FIT_UINT8 mesg_index;
    FIT_UINT16 mesg_sizes[FIT_MAX_LOCAL_MESGS];
-   FIT_UINT8 dev_data_sizes[FIT_MAX_LOCAL_MESGS];
+   FIT_UINT16 dev_data_sizes[FIT_MAX_LOCAL_MESGS];
+   FIT_CONVERT_DEV_FIELD dev_fields[FIT_MAX_LOCAL_MESGS][FIT_CONVERT_DEV_FIELDS];
+   FIT_UINT8 num_dev_fields[FIT_MAX_LOCAL_MESGS];
+   FIT_UINT16 dev_data_offset;
+   FIT_UINT8 dev_data[FIT_CONVERT_DEV_DATA_SIZE];
    FIT_UINT16 mesg_offset;
    FIT_UINT8 num_fields;
    FIT_UINT8 field_num;
@@ -108,6 +140,17 @@ typedef struct
    void FitConvert_Init(FIT_BOOL read_file_header);
 #endif
 
+///////////////////////////////////////////////////////////////////////
+// Initialize the state of the converter to parse the next file chained
+// in the same stream after FIT_CONVERT_END_OF_FILE. Decoding continues
+// from the current position in the data passed to FitConvert_Read().
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   void FitConvert_InitNext(FIT_CONVERT_STATE *state, FIT_BOOL read_file_header);
+#else
+   void FitConvert_InitNext(FIT_BOOL read_file_header);
+#endif
+
 ///////////////////////////////////////////////////////////////////////
 // Convert a stream of bytes.
 // Parameters:
@@ -205,6 +248,35 @@ typedef struct
     FIT_UINT8 FitConvert_GetFieldSize(FIT_UINT8 field);
 #endif
 
+///////////////////////////////////////////////////////////////////////
+// Returns the developer fields of the decoded message definition.
+// Field bytes are at dev_fields[i].offset in FitConvert_GetDevData(),
+// in the byte order of FitConvert_GetMessageArch().
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   const FIT_CONVERT_DEV_FIELD *FitConvert_GetDevFields(FIT_CONVERT_STATE *state, FIT_UINT8 *num_dev_fields);
+#else
+   const FIT_CONVERT_DEV_FIELD *FitConvert_GetDevFields(FIT_UINT8 *num_dev_fields);
+#endif
+
+///////////////////////////////////////////////////////////////////////
+// Returns a pointer to the developer data of the decoded message.
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   const FIT_UINT8 *FitConvert_GetDevData(FIT_CONVERT_STATE *state);
+#else
+   const FIT_UINT8 *FitConvert_GetDevData(void);
+#endif
+
+///////////////////////////////////////////////////////////////////////
+// Returns the architecture (endianness) of the decoded message.
+///////////////////////////////////////////////////////////////////////
+#if defined(FIT_CONVERT_MULTI_THREAD)
+   FIT_UINT8 FitConvert_GetMessageArch(FIT_CONVERT_STATE *state);
+#else
+   FIT_UINT8 FitConvert_GetMessageArch(void);
+#endif
+
 #if defined(__cplusplus)
    }
 #endif
@@ -1327,11 +1327,11 @@ static const FIT_HR_MESG_DEF hr_mesg_def =
    6, // num_fields
    { // field_def_num, size, base_type
       FIT_HR_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
-      FIT_HR_FIELD_NUM_EVENT_TIMESTAMP, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_HR_FIELD_NUM_EVENT_TIMESTAMP, (sizeof(FIT_UINT32)*8), FIT_BASE_TYPE_UINT32,
       FIT_HR_FIELD_NUM_FRACTIONAL_TIMESTAMP, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
       FIT_HR_FIELD_NUM_TIME256, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
-      FIT_HR_FIELD_NUM_FILTERED_BPM, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
-      FIT_HR_FIELD_NUM_EVENT_TIMESTAMP_12, (sizeof(FIT_BYTE)*1), FIT_BASE_TYPE_BYTE,
+      FIT_HR_FIELD_NUM_FILTERED_BPM, (sizeof(FIT_UINT8)*8), FIT_BASE_TYPE_UINT8,
+      FIT_HR_FIELD_NUM_EVENT_TIMESTAMP_12, (sizeof(FIT_BYTE)*12), FIT_BASE_TYPE_BYTE,
    }
 };
 
@@ -1425,7 +1425,56 @@ static const FIT_HRV_MESG_DEF hrv_mesg_def =
    FIT_MESG_NUM_HRV, // global_mesg_num
    1, // num_fields
    { // field_def_num, size, base_type
-      FIT_HRV_FIELD_NUM_TIME, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_HRV_FIELD_NUM_TIME, (sizeof(FIT_UINT16)*5), FIT_BASE_TYPE_UINT16,
+   }
+};
+
+static const FIT_GYROSCOPE_DATA_MESG_DEF gyroscope_data_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_GYROSCOPE_DATA, // global_mesg_num
+   6, // num_fields
+   { // field_def_num, size, base_type
+      FIT_GYROSCOPE_DATA_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_TIMESTAMP_MS, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_SAMPLE_TIME_OFFSET, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_X, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_Y, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_Z, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+   }
+};
+
+static const FIT_ACCELEROMETER_DATA_MESG_DEF accelerometer_data_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_ACCELEROMETER_DATA, // global_mesg_num
+   6, // num_fields
+   { // field_def_num, size, base_type
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_TIMESTAMP_MS, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_SAMPLE_TIME_OFFSET, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_X, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_Y, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_Z, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+   }
+};
+
+static const FIT_THREE_D_SENSOR_CALIBRATION_MESG_DEF three_d_sensor_calibration_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_THREE_D_SENSOR_CALIBRATION, // global_mesg_num
+   7, // num_fields
+   { // field_def_num, size, base_type
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_CALIBRATION_FACTOR, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_CALIBRATION_DIVISOR, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_LEVEL_SHIFT, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_OFFSET_CAL, (sizeof(FIT_SINT32)*3), FIT_BASE_TYPE_SINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_ORIENTATION_MATRIX, (sizeof(FIT_SINT32)*9), FIT_BASE_TYPE_SINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_SENSOR_TYPE, (sizeof(FIT_SENSOR_TYPE)*1), FIT_BASE_TYPE_ENUM,
    }
 };
 
@@ -1497,6 +1546,9 @@ const FIT_CONST_MESG_DEF_PTR fit_mesg_defs[] =
    (FIT_CONST_MESG_DEF_PTR) &exd_data_field_configuration_mesg_def,
    (FIT_CONST_MESG_DEF_PTR) &exd_data_concept_configuration_mesg_def,
    (FIT_CONST_MESG_DEF_PTR) &hrv_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &gyroscope_data_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &accelerometer_data_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &three_d_sensor_calibration_mesg_def,
 };
 
 ///////////////////////////////////////////////////////////////////////
@@ -7752,11 +7752,11 @@ typedef struct
 
 // hr message
 
-#define FIT_HR_MESG_SIZE                                                        13
+#define FIT_HR_MESG_SIZE                                                        59
 #define FIT_HR_MESG_DEF_SIZE                                                    23
-#define FIT_HR_MESG_EVENT_TIMESTAMP_COUNT                                       1
-#define FIT_HR_MESG_FILTERED_BPM_COUNT                                          1
-#define FIT_HR_MESG_EVENT_TIMESTAMP_12_COUNT                                    1
+#define FIT_HR_MESG_EVENT_TIMESTAMP_COUNT                                       8
+#define FIT_HR_MESG_FILTERED_BPM_COUNT                                          8
+#define FIT_HR_MESG_EVENT_TIMESTAMP_12_COUNT                                    12
 
 typedef struct
 {
@@ -8033,9 +8033,9 @@ typedef struct
 
 // hrv message
 
-#define FIT_HRV_MESG_SIZE                                                       2
+#define FIT_HRV_MESG_SIZE                                                       10
 #define FIT_HRV_MESG_DEF_SIZE                                                   8
-#define FIT_HRV_MESG_TIME_COUNT                                                 1
+#define FIT_HRV_MESG_TIME_COUNT                                                 5
 
 typedef struct
 {
@@ -8061,6 +8061,151 @@ typedef struct
    FIT_UINT8 fields[FIT_HRV_MESG_FIELDS * FIT_FIELD_DEF_SIZE];
 } FIT_HRV_MESG_DEF;
 
+// gyroscope_data message
+
+#define FIT_GYROSCOPE_DATA_MESG_SIZE                                    246
+#define FIT_GYROSCOPE_DATA_MESG_DEF_SIZE                                23
+#define FIT_GYROSCOPE_DATA_MESG_SAMPLE_TIME_OFFSET_COUNT                30
+#define FIT_GYROSCOPE_DATA_MESG_GYRO_X_COUNT                            30
+#define FIT_GYROSCOPE_DATA_MESG_GYRO_Y_COUNT                            30
+#define FIT_GYROSCOPE_DATA_MESG_GYRO_Z_COUNT                            30
+
+typedef struct
+{
+   FIT_DATE_TIME timestamp; // 1 * s + 0, Whole second part of the timestamp
+   FIT_UINT16 timestamp_ms; // 1 * ms + 0, Millisecond part of the timestamp.
+   FIT_UINT16 sample_time_offset[FIT_GYROSCOPE_DATA_MESG_SAMPLE_TIME_OFFSET_COUNT]; // 1 * ms + 0, Each time in the array describes the time at which the sample with the corrosponding index was taken. Limited to 30 samples in each message.
+   FIT_UINT16 gyro_x[FIT_GYROSCOPE_DATA_MESG_GYRO_X_COUNT]; // 1 * counts + 0, These are the raw ADC reading. Maximum number of samples is 30 in each message.
+   FIT_UINT16 gyro_y[FIT_GYROSCOPE_DATA_MESG_GYRO_Y_COUNT]; // 1 * counts + 0, These are the raw ADC reading. Maximum number of samples is 30 in each message.
+   FIT_UINT16 gyro_z[FIT_GYROSCOPE_DATA_MESG_GYRO_Z_COUNT]; // 1 * counts + 0, These are the raw ADC reading. Maximum number of samples is 30 in each message.
+} FIT_GYROSCOPE_DATA_MESG;
+
+typedef FIT_UINT8 FIT_GYROSCOPE_DATA_FIELD_NUM;
+
+#define FIT_GYROSCOPE_DATA_FIELD_NUM_TIMESTAMP ((FIT_GYROSCOPE_DATA_FIELD_NUM)253)
+#define FIT_GYROSCOPE_DATA_FIELD_NUM_TIMESTAMP_MS ((FIT_GYROSCOPE_DATA_FIELD_NUM)0)
+#define FIT_GYROSCOPE_DATA_FIELD_NUM_SAMPLE_TIME_OFFSET ((FIT_GYROSCOPE_DATA_FIELD_NUM)1)
+#define FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_X ((FIT_GYROSCOPE_DATA_FIELD_NUM)2)
+#define FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_Y ((FIT_GYROSCOPE_DATA_FIELD_NUM)3)
+#define FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_Z ((FIT_GYROSCOPE_DATA_FIELD_NUM)4)
+
+typedef enum
+{
+   FIT_GYROSCOPE_DATA_MESG_TIMESTAMP,
+   FIT_GYROSCOPE_DATA_MESG_TIMESTAMP_MS,
+   FIT_GYROSCOPE_DATA_MESG_SAMPLE_TIME_OFFSET,
+   FIT_GYROSCOPE_DATA_MESG_GYRO_X,
+   FIT_GYROSCOPE_DATA_MESG_GYRO_Y,
+   FIT_GYROSCOPE_DATA_MESG_GYRO_Z,
+   FIT_GYROSCOPE_DATA_MESG_FIELDS
+} FIT_GYROSCOPE_DATA_MESG_FIELD;
+
+typedef struct
+{
+   FIT_UINT8 reserved_1;
+   FIT_UINT8 arch;
+   FIT_MESG_NUM global_mesg_num;
+   FIT_UINT8 num_fields;
+   FIT_UINT8 fields[FIT_GYROSCOPE_DATA_MESG_FIELDS * FIT_FIELD_DEF_SIZE];
+} FIT_GYROSCOPE_DATA_MESG_DEF;
+
+// accelerometer_data message
+
+#define FIT_ACCELEROMETER_DATA_MESG_SIZE                                246
+#define FIT_ACCELEROMETER_DATA_MESG_DEF_SIZE                            23
+#define FIT_ACCELEROMETER_DATA_MESG_SAMPLE_TIME_OFFSET_COUNT            30
+#define FIT_ACCELEROMETER_DATA_MESG_ACCEL_X_COUNT                       30
+#define FIT_ACCELEROMETER_DATA_MESG_ACCEL_Y_COUNT                       30
+#define FIT_ACCELEROMETER_DATA_MESG_ACCEL_Z_COUNT                       30
+
+typedef struct
+{
+   FIT_DATE_TIME timestamp; // 1 * s + 0, Whole second part of the timestamp
+   FIT_UINT16 timestamp_ms; // 1 * ms + 0, Millisecond part of the timestamp.
+   FIT_UINT16 sample_time_offset[FIT_ACCELEROMETER_DATA_MESG_SAMPLE_TIME_OFFSET_COUNT]; // 1 * ms + 0, Each time in the array describes the time at which the sample with the corrosponding index was taken. Limited to 30 samples in each message.
+   FIT_UINT16 accel_x[FIT_ACCELEROMETER_DATA_MESG_ACCEL_X_COUNT]; // 1 * counts + 0, These are the raw ADC reading. Maximum number of samples is 30 in each message.
+   FIT_UINT16 accel_y[FIT_ACCELEROMETER_DATA_MESG_ACCEL_Y_COUNT]; // 1 * counts + 0, These are the raw ADC reading. Maximum number of samples is 30 in each message.
+   FIT_UINT16 accel_z[FIT_ACCELEROMETER_DATA_MESG_ACCEL_Z_COUNT]; // 1 * counts + 0, These are the raw ADC reading. Maximum number of samples is 30 in each message.
+} FIT_ACCELEROMETER_DATA_MESG;
+
+typedef FIT_UINT8 FIT_ACCELEROMETER_DATA_FIELD_NUM;
+
+#define FIT_ACCELEROMETER_DATA_FIELD_NUM_TIMESTAMP ((FIT_ACCELEROMETER_DATA_FIELD_NUM)253)
+#define FIT_ACCELEROMETER_DATA_FIELD_NUM_TIMESTAMP_MS ((FIT_ACCELEROMETER_DATA_FIELD_NUM)0)
+#define FIT_ACCELEROMETER_DATA_FIELD_NUM_SAMPLE_TIME_OFFSET ((FIT_ACCELEROMETER_DATA_FIELD_NUM)1)
+#define FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_X ((FIT_ACCELEROMETER_DATA_FIELD_NUM)2)
+#define FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_Y ((FIT_ACCELEROMETER_DATA_FIELD_NUM)3)
+#define FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_Z ((FIT_ACCELEROMETER_DATA_FIELD_NUM)4)
+
+typedef enum
+{
+   FIT_ACCELEROMETER_DATA_MESG_TIMESTAMP,
+   FIT_ACCELEROMETER_DATA_MESG_TIMESTAMP_MS,
+   FIT_ACCELEROMETER_DATA_MESG_SAMPLE_TIME_OFFSET,
+   FIT_ACCELEROMETER_DATA_MESG_ACCEL_X,
+   FIT_ACCELEROMETER_DATA_MESG_ACCEL_Y,
+   FIT_ACCELEROMETER_DATA_MESG_ACCEL_Z,
+   FIT_ACCELEROMETER_DATA_MESG_FIELDS
+} FIT_ACCELEROMETER_DATA_MESG_FIELD;
+
+typedef struct
+{
+   FIT_UINT8 reserved_1;
+   FIT_UINT8 arch;
+   FIT_MESG_NUM global_mesg_num;
+   FIT_UINT8 num_fields;
+   FIT_UINT8 fields[FIT_ACCELEROMETER_DATA_MESG_FIELDS * FIT_FIELD_DEF_SIZE];
+} FIT_ACCELEROMETER_DATA_MESG_DEF;
+
+// three_d_sensor_calibration message
+
+#define FIT_THREE_D_SENSOR_CALIBRATION_MESG_SIZE                        65
+#define FIT_THREE_D_SENSOR_CALIBRATION_MESG_DEF_SIZE                    26
+#define FIT_THREE_D_SENSOR_CALIBRATION_MESG_OFFSET_CAL_COUNT            3
+#define FIT_THREE_D_SENSOR_CALIBRATION_MESG_ORIENTATION_MATRIX_COUNT    9
+
+typedef struct
+{
+   FIT_DATE_TIME timestamp; // 1 * s + 0, Whole second part of the timestamp
+   FIT_UINT32 calibration_factor; // Calibration factor used to convert from raw ADC value to degrees, g,  etc.
+   FIT_UINT32 calibration_divisor; // 1 * counts + 0, Calibration factor divisor
+   FIT_UINT32 level_shift; // Level shift value used to shift the ADC value back into range
+   FIT_SINT32 offset_cal[FIT_THREE_D_SENSOR_CALIBRATION_MESG_OFFSET_CAL_COUNT]; // Internal calibration factors, one for each: xy, yx, zx
+   FIT_SINT32 orientation_matrix[FIT_THREE_D_SENSOR_CALIBRATION_MESG_ORIENTATION_MATRIX_COUNT]; // 65535 * + 0, 3 x 3 rotation matrix (row major)
+   FIT_SENSOR_TYPE sensor_type; // Indicates which sensor the calibration is for
+} FIT_THREE_D_SENSOR_CALIBRATION_MESG;
+
+typedef FIT_UINT8 FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM;
+
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_TIMESTAMP ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)253)
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_CALIBRATION_FACTOR ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)1)
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_CALIBRATION_DIVISOR ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)2)
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_LEVEL_SHIFT ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)3)
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_OFFSET_CAL ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)4)
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_ORIENTATION_MATRIX ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)5)
+#define FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_SENSOR_TYPE ((FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM)0)
+
+typedef enum
+{
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_TIMESTAMP,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_CALIBRATION_FACTOR,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_CALIBRATION_DIVISOR,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_LEVEL_SHIFT,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_OFFSET_CAL,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_ORIENTATION_MATRIX,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_SENSOR_TYPE,
+   FIT_THREE_D_SENSOR_CALIBRATION_MESG_FIELDS
+} FIT_THREE_D_SENSOR_CALIBRATION_MESG_FIELD;
+
+typedef struct
+{
+   FIT_UINT8 reserved_1;
+   FIT_UINT8 arch;
+   FIT_MESG_NUM global_mesg_num;
+   FIT_UINT8 num_fields;
+   FIT_UINT8 fields[FIT_THREE_D_SENSOR_CALIBRATION_MESG_FIELDS * FIT_FIELD_DEF_SIZE];
+} FIT_THREE_D_SENSOR_CALIBRATION_MESG_DEF;
+
 typedef enum {
    FIT_MESG_PAD,
    FIT_MESG_FILE_ID,
@@ -8127,6 +8272,9 @@ typedef enum {
    FIT_MESG_EXD_DATA_FIELD_CONFIGURATION,
    FIT_MESG_EXD_DATA_CONCEPT_CONFIGURATION,
    FIT_MESG_HRV,
+   FIT_MESG_GYROSCOPE_DATA,
+   FIT_MESG_ACCELEROMETER_DATA,
+   FIT_MESG_THREE_D_SENSOR_CALIBRATION,
    FIT_MESGS
 } FIT_MESG;
 
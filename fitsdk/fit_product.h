@@ -18,5 +18,5 @@
 #pragma once
 
 #include "fit_product.h"
-#include "fit_example.h"
+#include "fit_profile.h"
 #include "fit_config.h"
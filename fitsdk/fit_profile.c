@@ -0,0 +1,266 @@
+////////////////////////////////////////////////////////////////////////////////
+// The following FIT Protocol software provided may be used with FIT protocol
+// devices only and remains the copyrighted property of Garmin Canada Inc.
+// The software is being provided on an "as-is" basis and as an accommodation,
+// and therefore all warranties, representations, or guarantees of any kind
+// (whether express, implied or statutory) including, without limitation,
+// warranties of merchantability, non-infringement, or fitness for a particular
+// purpose, are specifically disclaimed.
+//
+// Copyright 2021 Garmin International, Inc.
+////////////////////////////////////////////////////////////////////////////////
+// ****WARNING****  This file is auto-generated!  Do NOT edit this file.
+// Profile Version = 21.67Release
+// Tag = production/akw/21.67.00-0-gd790f76b
+// Product = EXAMPLE
+// Alignment = 4 bytes, padding disabled.
+// Trimmed by trim_profile.py from the SDK profile, only the messages and fields decoded by fitconvert.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "string.h"
+#include "fit_product.h"
+
+
+///////////////////////////////////////////////////////////////////////
+// Messages
+///////////////////////////////////////////////////////////////////////
+
+static const FIT_RECORD_MESG_DEF record_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_RECORD, // global_mesg_num
+   13, // num_fields
+   { // field_def_num, size, base_type
+      FIT_RECORD_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_RECORD_FIELD_NUM_POSITION_LAT, (sizeof(FIT_SINT32)*1), FIT_BASE_TYPE_SINT32,
+      FIT_RECORD_FIELD_NUM_POSITION_LONG, (sizeof(FIT_SINT32)*1), FIT_BASE_TYPE_SINT32,
+      FIT_RECORD_FIELD_NUM_DISTANCE, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_RECORD_FIELD_NUM_ENHANCED_SPEED, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_RECORD_FIELD_NUM_ENHANCED_ALTITUDE, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_RECORD_FIELD_NUM_ALTITUDE, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_RECORD_FIELD_NUM_SPEED, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_RECORD_FIELD_NUM_POWER, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_RECORD_FIELD_NUM_GRADE, (sizeof(FIT_SINT16)*1), FIT_BASE_TYPE_SINT16,
+      FIT_RECORD_FIELD_NUM_HEART_RATE, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
+      FIT_RECORD_FIELD_NUM_CADENCE, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
+      FIT_RECORD_FIELD_NUM_TEMPERATURE, (sizeof(FIT_SINT8)*1), FIT_BASE_TYPE_SINT8,
+   }
+};
+
+static const FIT_EVENT_MESG_DEF event_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_EVENT, // global_mesg_num
+   3, // num_fields
+   { // field_def_num, size, base_type
+      FIT_EVENT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_EVENT_FIELD_NUM_EVENT, (sizeof(FIT_EVENT)*1), FIT_BASE_TYPE_ENUM,
+      FIT_EVENT_FIELD_NUM_EVENT_TYPE, (sizeof(FIT_EVENT_TYPE)*1), FIT_BASE_TYPE_ENUM,
+   }
+};
+
+static const FIT_HR_MESG_DEF hr_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_HR, // global_mesg_num
+   5, // num_fields
+   { // field_def_num, size, base_type
+      FIT_HR_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_HR_FIELD_NUM_EVENT_TIMESTAMP, (sizeof(FIT_UINT32)*8), FIT_BASE_TYPE_UINT32,
+      FIT_HR_FIELD_NUM_FRACTIONAL_TIMESTAMP, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_HR_FIELD_NUM_FILTERED_BPM, (sizeof(FIT_UINT8)*8), FIT_BASE_TYPE_UINT8,
+      FIT_HR_FIELD_NUM_EVENT_TIMESTAMP_12, (sizeof(FIT_BYTE)*12), FIT_BASE_TYPE_BYTE,
+   }
+};
+
+static const FIT_HRV_MESG_DEF hrv_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_HRV, // global_mesg_num
+   1, // num_fields
+   { // field_def_num, size, base_type
+      FIT_HRV_FIELD_NUM_TIME, (sizeof(FIT_UINT16)*5), FIT_BASE_TYPE_UINT16,
+   }
+};
+
+static const FIT_ACCELEROMETER_DATA_MESG_DEF accelerometer_data_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_ACCELEROMETER_DATA, // global_mesg_num
+   6, // num_fields
+   { // field_def_num, size, base_type
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_TIMESTAMP_MS, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_SAMPLE_TIME_OFFSET, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_X, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_Y, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_ACCELEROMETER_DATA_FIELD_NUM_ACCEL_Z, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+   }
+};
+
+static const FIT_GYROSCOPE_DATA_MESG_DEF gyroscope_data_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_GYROSCOPE_DATA, // global_mesg_num
+   6, // num_fields
+   { // field_def_num, size, base_type
+      FIT_GYROSCOPE_DATA_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_TIMESTAMP_MS, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_SAMPLE_TIME_OFFSET, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_X, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_Y, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+      FIT_GYROSCOPE_DATA_FIELD_NUM_GYRO_Z, (sizeof(FIT_UINT16)*30), FIT_BASE_TYPE_UINT16,
+   }
+};
+
+static const FIT_THREE_D_SENSOR_CALIBRATION_MESG_DEF three_d_sensor_calibration_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_THREE_D_SENSOR_CALIBRATION, // global_mesg_num
+   7, // num_fields
+   { // field_def_num, size, base_type
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_CALIBRATION_FACTOR, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_CALIBRATION_DIVISOR, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_LEVEL_SHIFT, (sizeof(FIT_UINT32)*1), FIT_BASE_TYPE_UINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_OFFSET_CAL, (sizeof(FIT_SINT32)*3), FIT_BASE_TYPE_SINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_ORIENTATION_MATRIX, (sizeof(FIT_SINT32)*9), FIT_BASE_TYPE_SINT32,
+      FIT_THREE_D_SENSOR_CALIBRATION_FIELD_NUM_SENSOR_TYPE, (sizeof(FIT_SENSOR_TYPE)*1), FIT_BASE_TYPE_ENUM,
+   }
+};
+
+
+static const FIT_FIELD_DESCRIPTION_MESG_DEF field_description_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_FIELD_DESCRIPTION, // global_mesg_num
+   7, // num_fields
+   { // field_def_num, size, base_type
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_FIELD_NAME, (sizeof(FIT_STRING)*64), FIT_BASE_TYPE_STRING,
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_UNITS, (sizeof(FIT_STRING)*16), FIT_BASE_TYPE_STRING,
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_DEVELOPER_DATA_INDEX, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_FIELD_DEFINITION_NUMBER, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_FIT_BASE_TYPE_ID, (sizeof(FIT_FIT_BASE_TYPE)*1), FIT_BASE_TYPE_UINT8,
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_SCALE, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
+      FIT_FIELD_DESCRIPTION_FIELD_NUM_OFFSET, (sizeof(FIT_SINT8)*1), FIT_BASE_TYPE_SINT8,
+   }
+};
+
+static const FIT_DEVELOPER_DATA_ID_MESG_DEF developer_data_id_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_DEVELOPER_DATA_ID, // global_mesg_num
+   2, // num_fields
+   { // field_def_num, size, base_type
+      FIT_DEVELOPER_DATA_ID_FIELD_NUM_APPLICATION_ID, (sizeof(FIT_BYTE)*16), FIT_BASE_TYPE_BYTE,
+      FIT_DEVELOPER_DATA_ID_FIELD_NUM_DEVELOPER_DATA_INDEX, (sizeof(FIT_UINT8)*1), FIT_BASE_TYPE_UINT8,
+   }
+};
+
+static const FIT_FILE_ID_MESG_DEF file_id_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_FILE_ID, // global_mesg_num
+   7, // num_fields
+   { // field_def_num, size, base_type
+      FIT_FILE_ID_FIELD_NUM_SERIAL_NUMBER, (sizeof(FIT_UINT32Z)*1), FIT_BASE_TYPE_UINT32Z,
+      FIT_FILE_ID_FIELD_NUM_TIME_CREATED, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32,
+      FIT_FILE_ID_FIELD_NUM_PRODUCT_NAME, (sizeof(FIT_STRING)*20), FIT_BASE_TYPE_STRING,
+      FIT_FILE_ID_FIELD_NUM_MANUFACTURER, (sizeof(FIT_MANUFACTURER)*1), FIT_BASE_TYPE_UINT16,
+      FIT_FILE_ID_FIELD_NUM_PRODUCT, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_FILE_ID_FIELD_NUM_NUMBER, (sizeof(FIT_UINT16)*1), FIT_BASE_TYPE_UINT16,
+      FIT_FILE_ID_FIELD_NUM_TYPE, (sizeof(FIT_FILE)*1), FIT_BASE_TYPE_ENUM,
+   }
+};
+
+static const FIT_PAD_MESG_DEF pad_mesg_def =
+{
+   0, // reserved_1
+   FIT_ARCH_ENDIAN, // arch
+   FIT_MESG_NUM_PAD, // global_mesg_num
+   0 // num_fields
+};
+
+
+static const FIT_TIMESTAMP_MESG_DEF timestamp_mesg_defs[] =
+{
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_ACTIVITY, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_SESSION, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_LAP, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_LENGTH, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_DEVICE_INFO, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_TRAINING_FILE, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_WEATHER_CONDITIONS, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_WEATHER_ALERT, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_NMEA_SENTENCE, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_AVIATION_ATTITUDE, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_COURSE_POINT, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_SEGMENT_LAP, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_TOTALS, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_WEIGHT_SCALE, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_BLOOD_PRESSURE, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_MONITORING_INFO, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_MONITORING, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_ANT_RX, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+   { 0, FIT_ARCH_ENDIAN, FIT_MESG_NUM_ANT_TX, 1, { FIT_FIELD_NUM_TIMESTAMP, (sizeof(FIT_DATE_TIME)*1), FIT_BASE_TYPE_UINT32 } },
+};
+
+
+const FIT_CONST_MESG_DEF_PTR fit_mesg_defs[] =
+{
+   (FIT_CONST_MESG_DEF_PTR) &record_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &event_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &hr_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &hrv_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &accelerometer_data_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &gyroscope_data_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &three_d_sensor_calibration_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &field_description_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &developer_data_id_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &file_id_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &pad_mesg_def,
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[0],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[1],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[2],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[3],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[4],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[5],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[6],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[7],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[8],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[9],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[10],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[11],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[12],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[13],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[14],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[15],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[16],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[17],
+   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[18],
+};
+
+///////////////////////////////////////////////////////////////////////
+// Files
+///////////////////////////////////////////////////////////////////////
+
+const FIT_FILE_MESG device_file_mesgs[] =
+{
+   { FIT_STRUCT_OFFSET(file_id_mesg_def, FIT_DEVICE_FILE), FIT_STRUCT_OFFSET(file_id_mesg, FIT_DEVICE_FILE) + FIT_HDR_SIZE, FIT_MESG_NUM_FILE_ID, FIT_DEVICE_FILE_FILE_ID_MESGS, FIT_MESG_FILE_ID},
+};
+
+const FIT_FILE_DEF fit_file_defs[] =
+{
+   { FIT_DEVICE_FILE_DATA_SIZE, (FIT_FILE_MESG *) &device_file_mesgs, FIT_DEVICE_FILE_MESG_COUNT, FIT_FILE_DEVICE, FIT_DEVICE_FILE_COUNT},
+};
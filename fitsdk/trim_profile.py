@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+# generates the trimmed profile fit_profile.h/.c from the SDK profile fit_example.h/.c
+# python3 fitsdk/trim_profile.py          regenerate after updating the SDK or the messages below
+# python3 fitsdk/trim_profile.py --check  fail if the committed files are out of sync (run by the build)
+#
+# only the messages and fields decoded by parser.cpp are kept, the hottest first as Fit_GetMesgDef scans linearly.
+# every other message with a timestamp keeps a timestamp-only definition, so the decoder still moves the compressed
+# timestamp reference on them exactly like with the full profile.
+
+import argparse
+import os
+import re
+import sys
+
+# message -> decoded fields, None keeps all fields, timestamp is always kept when the message has it
+KEEP = [
+    ('record', ['position_lat', 'position_long', 'distance', 'enhanced_speed', 'enhanced_altitude', 'altitude', 'speed', 'power',
+                'grade', 'heart_rate', 'cadence', 'temperature']),
+    ('event', ['event', 'event_type']),
+    ('hr', ['event_timestamp', 'fractional_timestamp', 'filtered_bpm', 'event_timestamp_12']),
+    ('hrv', ['time']),
+    ('accelerometer_data', ['timestamp_ms', 'sample_time_offset', 'accel_x', 'accel_y', 'accel_z']),
+    ('gyroscope_data', ['timestamp_ms', 'sample_time_offset', 'gyro_x', 'gyro_y', 'gyro_z']),
+    ('three_d_sensor_calibration', ['sensor_type', 'calibration_factor', 'calibration_divisor', 'level_shift', 'offset_cal',
+                                    'orientation_matrix']),
+    ('field_description', ['developer_data_index', 'field_definition_number', 'fit_base_type_id', 'field_name', 'scale', 'offset',
+                           'units']),
+    ('developer_data_id', ['developer_data_index', 'application_id']),
+    # fit_ram.c and the device file definitions
+    ('file_id', None),
+    ('pad', None),
+]
+
+BASE_TYPE_SIZES = {
+    'ENUM': 1, 'SINT8': 1, 'UINT8': 1, 'SINT16': 2, 'UINT16': 2, 'SINT32': 4, 'UINT32': 4, 'STRING': 1, 'FLOAT32': 4, 'FLOAT64': 8,
+    'UINT8Z': 1, 'UINT16Z': 2, 'UINT32Z': 4, 'BYTE': 1, 'SINT64': 8, 'UINT64': 8, 'UINT64Z': 8,
+}
+
+TIMESTAMP = 'TIMESTAMP'
+NOTE = '// Trimmed by trim_profile.py from the SDK profile, only the messages and fields decoded by fitconvert.'
+
+
+class ProfileError(Exception):
+    pass
+
+
+class Field:
+    def __init__(self, token, entry, count, base_type):
+        self.token = token
+        self.entry = entry
+        self.size = BASE_TYPE_SIZES[base_type] * count
+        self.type_size = BASE_TYPE_SIZES[base_type]
+
+
+class Message:
+    def __init__(self, name):
+        self.name = name
+        self.upper = name.upper()
+        self.header = []
+        self.source = []
+        self.fields = []
+        self.mesg_num = None
+
+    def field(self, token):
+        return next((field for field in self.fields if field.token == token), None)
+
+
+def read_lines(path):
+    with open(path, 'r', encoding='ascii', newline='') as file:
+        return file.read().replace('\r\n', '\n').split('\n')
+
+
+def index_of(lines, pattern, start=0):
+    regex = re.compile(pattern)
+    for index in range(start, len(lines)):
+        if regex.match(lines[index]):
+            return index
+    raise ProfileError(f'"{pattern}" is not found')
+
+
+def parse_header(lines, messages):
+    begin = index_of(lines, r'^#define FIT_MESG_DEF_SIZE ')
+    end = index_of(lines, r'^typedef enum \{$', begin)
+    section = None
+    for line in lines[begin + 1:end]:
+        match = re.match(r'^// (\w+) message$', line)
+        if match:
+            section = messages.setdefault(match.group(1), Message(match.group(1)))
+        if section is not None:
+            section.header.append(line)
+    return lines[:begin + 1], lines[end:]
+
+
+def parse_source(lines, messages):
+    begin = index_of(lines, r'^static const FIT_\w+_MESG_DEF \w+_mesg_def =$')
+    end = index_of(lines, r'^const FIT_CONST_MESG_DEF_PTR fit_mesg_defs\[\] =$', begin)
+    tail = index_of(lines, r'^};$', end) + 1
+    section = None
+    for line in lines[begin:end]:
+        match = re.match(r'^static const FIT_\w+_MESG_DEF (\w+)_mesg_def =$', line)
+        if match:
+            if match.group(1) not in messages:
+                raise ProfileError(f'{match.group(1)} is defined in the source but not in the header')
+            section = messages[match.group(1)]
+        section.source.append(line)
+        match = re.match(r'^   (FIT_MESG_NUM_\w+), // global_mesg_num$', line)
+        if match:
+            section.mesg_num = match.group(1)
+        match = re.match(rf'^      FIT_{section.upper}_FIELD_NUM_(\w+), \(sizeof\(\w+\)\*(\d+)\), FIT_BASE_TYPE_(\w+),$', line)
+        if match:
+            section.fields.append(Field(match.group(1), line, int(match.group(2)), match.group(3)))
+    return lines[:begin], lines[tail:]
+
+
+def validate(message):
+    match = re.search(rf'^#define FIT_{message.upper}_MESG_SIZE +(\d+)$', '\n'.join(message.header), re.MULTILINE)
+    expected = int(match.group(1)) if match else 0
+    if sum(field.size for field in message.fields) != expected:
+        raise ProfileError(f'{message.name} fields of the source do not match FIT_{message.upper}_MESG_SIZE')
+    tokens = [member.upper() for _, member in struct_members(message)]
+    if tokens != [field.token for field in message.fields]:
+        raise ProfileError(f'{message.name} struct and definition have different fields')
+
+
+def struct_members(message):
+    # (line index, name) of the members of the FIT_<NAME>_MESG struct, the pad message has none
+    members = []
+    for index, line in enumerate(message.header):
+        if line == f'}} FIT_{message.upper}_MESG;':
+            return members
+        if line == '{':
+            members = []
+        match = re.match(r'^   FIT_\w+ (\w+)(\[\w+\])?;', line)
+        if match:
+            members.append((index, match.group(1)))
+    return []
+
+
+def kept_fields(message, names):
+    if names is None:
+        return [field.token for field in message.fields]
+    tokens = {name.upper() for name in names}
+    for token in tokens:
+        if message.field(token) is None:
+            raise ProfileError(f'{message.name} has no field {token.lower()}')
+    if message.field(TIMESTAMP) is not None:
+        tokens.add(TIMESTAMP)
+    kept = [field for field in message.fields if field.token in tokens]
+    offset = 0
+    for field in kept:
+        # fields are sorted by type size in the SDK, the subset has no padding either
+        if offset % field.type_size != 0:
+            raise ProfileError(f'{message.name} field {field.token.lower()} is not aligned')
+        offset += field.size
+    return [field.token for field in kept]
+
+
+def trim_header(message, tokens):
+    kept = set(tokens)
+    upper = message.upper
+    members = dict(struct_members(message))
+    lines = []
+    for index, line in enumerate(message.header):
+        token = members[index].upper() if index in members else None
+        for pattern in (rf'^#define FIT_{upper}_MESG_(\w+)_COUNT ', rf'^#define FIT_{upper}_FIELD_NUM_(\w+) ', rf'^   FIT_{upper}_MESG_(\w+),$'):
+            match = re.match(pattern, line)
+            if match:
+                token = match.group(1)
+                break
+        if token is not None and token not in kept:
+            continue
+        if re.match(rf'^#define FIT_{upper}_MESG_SIZE ', line):
+            line = re.sub(r'\d+$', str(mesg_size(message, tokens)), line)
+        elif re.match(rf'^#define FIT_{upper}_MESG_DEF_SIZE ', line):
+            line = re.sub(r'\d+$', str(mesg_def_size(tokens)), line)
+        lines.append(line)
+    return lines
+
+
+def trim_source(message, tokens):
+    kept = {message.field(token).entry for token in tokens}
+    lines = []
+    for line in message.source:
+        if line in (field.entry for field in message.fields) and line not in kept:
+            continue
+        if line.endswith(', // num_fields'):
+            line = re.sub(r'^   \d+', f'   {len(tokens)}', line)
+        lines.append(line)
+    return lines
+
+
+def mesg_size(message, tokens):
+    return sum(message.field(token).size for token in tokens)
+
+
+def mesg_def_size(tokens):
+    return 5 + 3 * len(tokens)
+
+
+def generate(header_lines, source_lines):
+    messages = {}
+    header_prefix, header_suffix = parse_header(header_lines, messages)
+    source_prefix, source_suffix = parse_source(source_lines, messages)
+    for message in messages.values():
+        validate(message)
+
+    names = [name for name, _ in KEEP]
+    for name in names:
+        if name not in messages:
+            raise ProfileError(f'{name} message is not in the SDK profile')
+    kept = [(messages[name], kept_fields(messages[name], fields)) for name, fields in KEEP]
+    stubs = [message for message in messages.values() if message.name not in names and message.field(TIMESTAMP) is not None]
+
+    max_fields = max([len(tokens) for _, tokens in kept] + [1])
+    max_size = max(mesg_size(message, tokens) for message, tokens in kept)
+    max_def_size = max(mesg_def_size(tokens) for _, tokens in kept)
+
+    header = []
+    for line in header_prefix:
+        line = line.replace('FIT_EXAMPLE_H', 'FIT_PROFILE_H')
+        if re.match(r'^   FIT_FIELD_CONVERT fields\[\d+\];$', line):
+            line = f'   FIT_FIELD_CONVERT fields[{max_fields}];'
+        elif re.match(r'^#define FIT_MESG_SIZE ', line):
+            line = re.sub(r'\d+$', str(max_size), line)
+        elif re.match(r'^#define FIT_MESG_DEF_SIZE ', line):
+            line = re.sub(r'\d+$', str(max_def_size), line)
+        header.append(line)
+        if line.startswith('// Alignment = '):
+            header.append(NOTE)
+    header.append('')
+    for message, tokens in kept:
+        header += trim_header(message, tokens)
+    header += [
+        '// messages that are not decoded, only the timestamp for compressed timestamp headers',
+        '',
+        'typedef struct',
+        '{',
+        '   FIT_UINT8 reserved_1;',
+        '   FIT_UINT8 arch;',
+        '   FIT_MESG_NUM global_mesg_num;',
+        '   FIT_UINT8 num_fields;',
+        '   FIT_UINT8 fields[1 * FIT_FIELD_DEF_SIZE];',
+        '} FIT_TIMESTAMP_MESG_DEF;',
+        '',
+    ]
+    enum_end = index_of(header_suffix, r'^   FIT_MESGS$')
+    header.append(header_suffix[0])
+    header += [f'   FIT_MESG_{message.upper},' for message, _ in kept]
+    header += [f'   FIT_MESG_{message.upper},' for message in stubs]
+    header += [line.replace('FIT_EXAMPLE_H', 'FIT_PROFILE_H') for line in header_suffix[enum_end:]]
+
+    source = []
+    for line in source_prefix:
+        source.append(line)
+        if line.startswith('// Alignment = '):
+            source.append(NOTE)
+    for message, tokens in kept:
+        source += trim_source(message, tokens)
+    source.append('static const FIT_TIMESTAMP_MESG_DEF timestamp_mesg_defs[] =')
+    source.append('{')
+    for message in stubs:
+        entry = message.field(TIMESTAMP).entry.strip().rstrip(',')
+        entry = re.sub(rf'^FIT_{message.upper}_FIELD_NUM_TIMESTAMP', 'FIT_FIELD_NUM_TIMESTAMP', entry)
+        source.append(f'   {{ 0, FIT_ARCH_ENDIAN, {message.mesg_num}, 1, {{ {entry} }} }},')
+    source += ['};', '', '', 'const FIT_CONST_MESG_DEF_PTR fit_mesg_defs[] =', '{']
+    source += [f'   (FIT_CONST_MESG_DEF_PTR) &{message.name}_mesg_def,' for message, _ in kept]
+    source += [f'   (FIT_CONST_MESG_DEF_PTR) &timestamp_mesg_defs[{index}],' for index in range(len(stubs))]
+    source.append('};')
+    source += source_suffix
+    return '\r\n'.join(header), '\r\n'.join(source)
+
+
+def main():
+    directory = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description='trimmed FIT profile for fitconvert')
+    parser.add_argument('--sdk', default=directory, help='directory of fit_example.h/.c')
+    parser.add_argument('--output', default=directory, help='directory of fit_profile.h/.c')
+    parser.add_argument('--check', action='store_true', help='only compare with the existing files')
+    args = parser.parse_args()
+
+    try:
+        outputs = generate(read_lines(os.path.join(args.sdk, 'fit_example.h')), read_lines(os.path.join(args.sdk, 'fit_example.c')))
+    except ProfileError as error:
+        print(f'trim_profile: {error}', file=sys.stderr)
+        return 1
+
+    stale = []
+    for name, text in zip(('fit_profile.h', 'fit_profile.c'), outputs):
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = None
+            if os.path.exists(path):
+                with open(path, 'r', encoding='ascii', newline='') as file:
+                    current = file.read()
+            if current != text:
+                stale.append(path)
+        else:
+            with open(path, 'w', encoding='ascii', newline='') as file:
+                file.write(text)
+    for path in stale:
+        print(f'trim_profile: {path} is out of sync with the SDK profile, run fitsdk/trim_profile.py', file=sys.stderr)
+    return 1 if stale else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,579 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "kernels.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FITCONVERT_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define FITCONVERT_NEON 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#elif defined(__wasm_simd128__)
+#define FITCONVERT_SIMD128 1
+#include <wasm_simd128.h>
+#endif
+
+// variants of one translation unit are built for their instruction set, the dispatch runs them only on a cpu that has it
+#if defined(__GNUC__) || defined(__clang__)
+#define FITCONVERT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define FITCONVERT_TARGET(isa)
+#endif
+
+namespace {
+
+// byte i of the value is bit i of the index, little-endian
+constexpr std::array<uint64_t, 256u> kBitBytes = [] {
+  std::array<uint64_t, 256u> bytes{};
+  for (size_t bits = 0u; bits < bytes.size(); ++bits) {
+    for (size_t bit = 0u; bit < 8u; ++bit) {
+      bytes[bits] |= static_cast<uint64_t>((bits >> bit) & 1u) << (bit * 8u);
+    }
+  }
+  return bytes;
+}();
+
+// mask of 8 values from the comparison bits and the presence bytes
+inline void StoreMask(const uint32_t bits, const uint8_t* present_ptr, uint8_t* mask_ptr) {
+  uint64_t present{0u};
+  std::memcpy(&present, present_ptr, sizeof(present));
+  const uint64_t mask = kBitBytes[bits] & present;
+  std::memcpy(mask_ptr, &mask, sizeof(mask));
+}
+
+template <CompareOp op>
+inline bool Compare(const double value, const double threshold) {
+  if constexpr (op == CompareOp::kLess) {
+    return value < threshold;
+  } else if constexpr (op == CompareOp::kLessEqual) {
+    return value <= threshold;
+  } else if constexpr (op == CompareOp::kGreater) {
+    return value > threshold;
+  } else if constexpr (op == CompareOp::kGreaterEqual) {
+    return value >= threshold;
+  } else if constexpr (op == CompareOp::kEqual) {
+    return value == threshold;
+  } else {
+    return value != threshold;
+  }
+}
+
+template <CompareOp op>
+void CompareScalar(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr) {
+  for (size_t index = 0u; index < count; ++index) {
+    mask_ptr[index] = present_ptr[index] & static_cast<uint8_t>(Compare<op>(values_ptr[index], threshold));
+  }
+}
+
+void MaskAndScalar(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  for (size_t index = 0u; index < count; ++index) {
+    left_ptr[index] &= right_ptr[index];
+  }
+}
+
+void MaskOrScalar(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  for (size_t index = 0u; index < count; ++index) {
+    left_ptr[index] |= right_ptr[index];
+  }
+}
+
+void MaskNotScalar(uint8_t* mask_ptr, const size_t count) {
+  for (size_t index = 0u; index < count; ++index) {
+    mask_ptr[index] ^= 1u;
+  }
+}
+
+#define FITCONVERT_COMPARE_KERNELS(kernel)                                                                                 \
+  {                                                                                                                        \
+    kernel<CompareOp::kLess>, kernel<CompareOp::kLessEqual>, kernel<CompareOp::kGreater>, kernel<CompareOp::kGreaterEqual>, \
+        kernel<CompareOp::kEqual>, kernel<CompareOp::kNotEqual>                                                           \
+  }
+
+const Kernels kScalarKernels{Isa::kScalar, FITCONVERT_COMPARE_KERNELS(CompareScalar), MaskAndScalar, MaskOrScalar, MaskNotScalar};
+
+#if defined(FITCONVERT_X86)
+
+// ordered comparisons are false for NaN, not equal is unordered and true for it, the same as the scalar operators
+template <CompareOp op>
+FITCONVERT_TARGET("sse4.2")
+inline __m128d CompareSse42(const __m128d values, const __m128d threshold) {
+  if constexpr (op == CompareOp::kLess) {
+    return _mm_cmplt_pd(values, threshold);
+  } else if constexpr (op == CompareOp::kLessEqual) {
+    return _mm_cmple_pd(values, threshold);
+  } else if constexpr (op == CompareOp::kGreater) {
+    return _mm_cmpgt_pd(values, threshold);
+  } else if constexpr (op == CompareOp::kGreaterEqual) {
+    return _mm_cmpge_pd(values, threshold);
+  } else if constexpr (op == CompareOp::kEqual) {
+    return _mm_cmpeq_pd(values, threshold);
+  } else {
+    return _mm_cmpneq_pd(values, threshold);
+  }
+}
+
+template <CompareOp op>
+FITCONVERT_TARGET("sse4.2")
+void CompareColumnSse42(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr) {
+  const __m128d limit = _mm_set1_pd(threshold);
+  size_t index{0u};
+  for (; index + 8u <= count; index += 8u) {
+    uint32_t bits{0u};
+    for (size_t lane = 0u; lane < 8u; lane += 2u) {
+      bits |= static_cast<uint32_t>(_mm_movemask_pd(CompareSse42<op>(_mm_loadu_pd(values_ptr + index + lane), limit))) << lane;
+    }
+    StoreMask(bits, present_ptr + index, mask_ptr + index);
+  }
+  CompareScalar<op>(values_ptr + index, present_ptr + index, count - index, threshold, mask_ptr + index);
+}
+
+FITCONVERT_TARGET("sse4.2")
+void MaskAndSse42(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left_ptr + index));
+    const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right_ptr + index));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(left_ptr + index), _mm_and_si128(left, right));
+  }
+  MaskAndScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+FITCONVERT_TARGET("sse4.2")
+void MaskOrSse42(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left_ptr + index));
+    const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right_ptr + index));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(left_ptr + index), _mm_or_si128(left, right));
+  }
+  MaskOrScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+FITCONVERT_TARGET("sse4.2")
+void MaskNotSse42(uint8_t* mask_ptr, const size_t count) {
+  const __m128i ones = _mm_set1_epi8(1);
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_ptr + index));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(mask_ptr + index), _mm_xor_si128(mask, ones));
+  }
+  MaskNotScalar(mask_ptr + index, count - index);
+}
+
+template <CompareOp op>
+constexpr int kAvxPredicate = op == CompareOp::kLess           ? _CMP_LT_OQ
+                              : op == CompareOp::kLessEqual    ? _CMP_LE_OQ
+                              : op == CompareOp::kGreater      ? _CMP_GT_OQ
+                              : op == CompareOp::kGreaterEqual ? _CMP_GE_OQ
+                              : op == CompareOp::kEqual        ? _CMP_EQ_OQ
+                                                               : _CMP_NEQ_UQ;
+
+template <CompareOp op>
+FITCONVERT_TARGET("avx2")
+void CompareColumnAvx2(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr) {
+  const __m256d limit = _mm256_set1_pd(threshold);
+  size_t index{0u};
+  for (; index + 8u <= count; index += 8u) {
+    const __m256d low = _mm256_cmp_pd(_mm256_loadu_pd(values_ptr + index), limit, kAvxPredicate<op>);
+    const __m256d high = _mm256_cmp_pd(_mm256_loadu_pd(values_ptr + index + 4u), limit, kAvxPredicate<op>);
+    const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_pd(low)) | (static_cast<uint32_t>(_mm256_movemask_pd(high)) << 4u);
+    StoreMask(bits, present_ptr + index, mask_ptr + index);
+  }
+  CompareScalar<op>(values_ptr + index, present_ptr + index, count - index, threshold, mask_ptr + index);
+}
+
+FITCONVERT_TARGET("avx2")
+void MaskAndAvx2(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 32u <= count; index += 32u) {
+    const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left_ptr + index));
+    const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right_ptr + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(left_ptr + index), _mm256_and_si256(left, right));
+  }
+  MaskAndScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+FITCONVERT_TARGET("avx2")
+void MaskOrAvx2(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 32u <= count; index += 32u) {
+    const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left_ptr + index));
+    const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right_ptr + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(left_ptr + index), _mm256_or_si256(left, right));
+  }
+  MaskOrScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+FITCONVERT_TARGET("avx2")
+void MaskNotAvx2(uint8_t* mask_ptr, const size_t count) {
+  const __m256i ones = _mm256_set1_epi8(1);
+  size_t index{0u};
+  for (; index + 32u <= count; index += 32u) {
+    const __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask_ptr + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(mask_ptr + index), _mm256_xor_si256(mask, ones));
+  }
+  MaskNotScalar(mask_ptr + index, count - index);
+}
+
+template <CompareOp op>
+FITCONVERT_TARGET("avx512f")
+void CompareColumnAvx512(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr) {
+  const __m512d limit = _mm512_set1_pd(threshold);
+  size_t index{0u};
+  for (; index + 8u <= count; index += 8u) {
+    const __mmask8 bits = _mm512_cmp_pd_mask(_mm512_loadu_pd(values_ptr + index), limit, kAvxPredicate<op>);
+    StoreMask(static_cast<uint32_t>(bits), present_ptr + index, mask_ptr + index);
+  }
+  CompareScalar<op>(values_ptr + index, present_ptr + index, count - index, threshold, mask_ptr + index);
+}
+
+FITCONVERT_TARGET("avx512f")
+void MaskAndAvx512(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 64u <= count; index += 64u) {
+    const __m512i left = _mm512_loadu_si512(left_ptr + index);
+    const __m512i right = _mm512_loadu_si512(right_ptr + index);
+    _mm512_storeu_si512(left_ptr + index, _mm512_and_si512(left, right));
+  }
+  MaskAndAvx2(left_ptr + index, right_ptr + index, count - index);
+}
+
+FITCONVERT_TARGET("avx512f")
+void MaskOrAvx512(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 64u <= count; index += 64u) {
+    const __m512i left = _mm512_loadu_si512(left_ptr + index);
+    const __m512i right = _mm512_loadu_si512(right_ptr + index);
+    _mm512_storeu_si512(left_ptr + index, _mm512_or_si512(left, right));
+  }
+  MaskOrAvx2(left_ptr + index, right_ptr + index, count - index);
+}
+
+FITCONVERT_TARGET("avx512f")
+void MaskNotAvx512(uint8_t* mask_ptr, const size_t count) {
+  const __m512i ones = _mm512_set1_epi32(0x01010101);
+  size_t index{0u};
+  for (; index + 64u <= count; index += 64u) {
+    const __m512i mask = _mm512_loadu_si512(mask_ptr + index);
+    _mm512_storeu_si512(mask_ptr + index, _mm512_xor_si512(mask, ones));
+  }
+  MaskNotAvx2(mask_ptr + index, count - index);
+}
+
+const Kernels kSse42Kernels{Isa::kSse42, FITCONVERT_COMPARE_KERNELS(CompareColumnSse42), MaskAndSse42, MaskOrSse42, MaskNotSse42};
+const Kernels kAvx2Kernels{Isa::kAvx2, FITCONVERT_COMPARE_KERNELS(CompareColumnAvx2), MaskAndAvx2, MaskOrAvx2, MaskNotAvx2};
+const Kernels kAvx512Kernels{Isa::kAvx512, FITCONVERT_COMPARE_KERNELS(CompareColumnAvx512), MaskAndAvx512, MaskOrAvx512, MaskNotAvx512};
+
+#elif defined(FITCONVERT_NEON)
+
+template <CompareOp op>
+inline uint64x2_t CompareNeon(const float64x2_t values, const float64x2_t threshold) {
+  if constexpr (op == CompareOp::kLess) {
+    return vcltq_f64(values, threshold);
+  } else if constexpr (op == CompareOp::kLessEqual) {
+    return vcleq_f64(values, threshold);
+  } else if constexpr (op == CompareOp::kGreater) {
+    return vcgtq_f64(values, threshold);
+  } else if constexpr (op == CompareOp::kGreaterEqual) {
+    return vcgeq_f64(values, threshold);
+  } else if constexpr (op == CompareOp::kEqual) {
+    return vceqq_f64(values, threshold);
+  } else {
+    return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(vceqq_f64(values, threshold))));
+  }
+}
+
+template <CompareOp op>
+void CompareColumnNeon(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr) {
+  const float64x2_t limit = vdupq_n_f64(threshold);
+  size_t index{0u};
+  for (; index + 8u <= count; index += 8u) {
+    // all ones lanes narrowed to bytes
+    const uint32x4_t low = vcombine_u32(vmovn_u64(CompareNeon<op>(vld1q_f64(values_ptr + index), limit)),
+                                        vmovn_u64(CompareNeon<op>(vld1q_f64(values_ptr + index + 2u), limit)));
+    const uint32x4_t high = vcombine_u32(vmovn_u64(CompareNeon<op>(vld1q_f64(values_ptr + index + 4u), limit)),
+                                         vmovn_u64(CompareNeon<op>(vld1q_f64(values_ptr + index + 6u), limit)));
+    const uint8x8_t bytes = vmovn_u16(vcombine_u16(vmovn_u32(low), vmovn_u32(high)));
+    vst1_u8(mask_ptr + index, vand_u8(bytes, vld1_u8(present_ptr + index)));
+  }
+  CompareScalar<op>(values_ptr + index, present_ptr + index, count - index, threshold, mask_ptr + index);
+}
+
+void MaskAndNeon(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    vst1q_u8(left_ptr + index, vandq_u8(vld1q_u8(left_ptr + index), vld1q_u8(right_ptr + index)));
+  }
+  MaskAndScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+void MaskOrNeon(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    vst1q_u8(left_ptr + index, vorrq_u8(vld1q_u8(left_ptr + index), vld1q_u8(right_ptr + index)));
+  }
+  MaskOrScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+void MaskNotNeon(uint8_t* mask_ptr, const size_t count) {
+  const uint8x16_t ones = vdupq_n_u8(1u);
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    vst1q_u8(mask_ptr + index, veorq_u8(vld1q_u8(mask_ptr + index), ones));
+  }
+  MaskNotScalar(mask_ptr + index, count - index);
+}
+
+const Kernels kNeonKernels{Isa::kNeon, FITCONVERT_COMPARE_KERNELS(CompareColumnNeon), MaskAndNeon, MaskOrNeon, MaskNotNeon};
+
+#elif defined(FITCONVERT_SIMD128)
+
+template <CompareOp op>
+inline v128_t CompareSimd128(const v128_t values, const v128_t threshold) {
+  if constexpr (op == CompareOp::kLess) {
+    return wasm_f64x2_lt(values, threshold);
+  } else if constexpr (op == CompareOp::kLessEqual) {
+    return wasm_f64x2_le(values, threshold);
+  } else if constexpr (op == CompareOp::kGreater) {
+    return wasm_f64x2_gt(values, threshold);
+  } else if constexpr (op == CompareOp::kGreaterEqual) {
+    return wasm_f64x2_ge(values, threshold);
+  } else if constexpr (op == CompareOp::kEqual) {
+    return wasm_f64x2_eq(values, threshold);
+  } else {
+    return wasm_f64x2_ne(values, threshold);
+  }
+}
+
+template <CompareOp op>
+void CompareColumnSimd128(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr) {
+  const v128_t limit = wasm_f64x2_splat(threshold);
+  size_t index{0u};
+  for (; index + 8u <= count; index += 8u) {
+    uint32_t bits{0u};
+    for (size_t lane = 0u; lane < 8u; lane += 2u) {
+      bits |= static_cast<uint32_t>(wasm_i64x2_bitmask(CompareSimd128<op>(wasm_v128_load(values_ptr + index + lane), limit))) << lane;
+    }
+    StoreMask(bits, present_ptr + index, mask_ptr + index);
+  }
+  CompareScalar<op>(values_ptr + index, present_ptr + index, count - index, threshold, mask_ptr + index);
+}
+
+void MaskAndSimd128(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    wasm_v128_store(left_ptr + index, wasm_v128_and(wasm_v128_load(left_ptr + index), wasm_v128_load(right_ptr + index)));
+  }
+  MaskAndScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+void MaskOrSimd128(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count) {
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    wasm_v128_store(left_ptr + index, wasm_v128_or(wasm_v128_load(left_ptr + index), wasm_v128_load(right_ptr + index)));
+  }
+  MaskOrScalar(left_ptr + index, right_ptr + index, count - index);
+}
+
+void MaskNotSimd128(uint8_t* mask_ptr, const size_t count) {
+  const v128_t ones = wasm_i8x16_splat(1);
+  size_t index{0u};
+  for (; index + 16u <= count; index += 16u) {
+    wasm_v128_store(mask_ptr + index, wasm_v128_xor(wasm_v128_load(mask_ptr + index), ones));
+  }
+  MaskNotScalar(mask_ptr + index, count - index);
+}
+
+const Kernels kSimd128Kernels{Isa::kSimd128, FITCONVERT_COMPARE_KERNELS(CompareColumnSimd128), MaskAndSimd128, MaskOrSimd128, MaskNotSimd128};
+
+#endif
+
+#undef FITCONVERT_COMPARE_KERNELS
+
+bool CpuSupports(const Isa isa) {
+  switch (isa) {
+    case Isa::kScalar:
+      return true;
+#if defined(FITCONVERT_X86)
+#if defined(__GNUC__) || defined(__clang__)
+    case Isa::kSse42:
+      return __builtin_cpu_supports("sse4.2");
+    case Isa::kAvx2:
+      return __builtin_cpu_supports("avx2");
+    case Isa::kAvx512:
+      return __builtin_cpu_supports("avx512f");
+#else
+    case Isa::kSse42:
+    case Isa::kAvx2:
+    case Isa::kAvx512: {
+      int info[4]{};
+      __cpuid(info, 1);
+      const bool sse42 = (info[2] & (1 << 20)) != 0;
+      // registers of avx are saved by the os
+      const uint64_t xcr0 = (info[2] & (1 << 27)) != 0 ? _xgetbv(0) : 0u;
+      __cpuidex(info, 7, 0);
+      if (isa == Isa::kSse42) {
+        return sse42;
+      }
+      if (isa == Isa::kAvx2) {
+        return (xcr0 & 0x06u) == 0x06u && (info[1] & (1 << 5)) != 0;
+      }
+      return (xcr0 & 0xE6u) == 0xE6u && (info[1] & (1 << 16)) != 0;
+    }
+#endif
+#elif defined(FITCONVERT_NEON)
+    case Isa::kNeon:
+#if defined(__linux__)
+      return (getauxval(AT_HWCAP) & HWCAP_ASIMD) != 0u;
+#else
+      return true;
+#endif
+#elif defined(FITCONVERT_SIMD128)
+    case Isa::kSimd128:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+const Kernels& SelectKernels() {
+  const std::vector<Isa> isas = SupportedIsas();
+  Isa isa = isas.back();
+  if (const char* forced = std::getenv(kIsaEnvironment.data())) {
+    const auto it = std::find_if(isas.begin(), isas.end(), [forced](const Isa supported) { return IsaName(supported) == forced; });
+    if (it != isas.end()) {
+      isa = *it;
+    } else {
+      SPDLOG_WARN("{} '{}' is not supported by this cpu or build, {} is used", kIsaEnvironment, forced, IsaName(isa));
+    }
+  }
+  SPDLOG_DEBUG("simd kernels: {}", IsaName(isa));
+  return KernelsFor(isa);
+}
+
+// table[0] is the byte-wise crc-16 (reflected 0x8005), table[k] is table[0] advanced by k zero bytes
+constexpr std::array<std::array<uint16_t, 256>, 8> MakeCrcTables() {
+  std::array<std::array<uint16_t, 256>, 8> tables{};
+  for (uint32_t byte = 0u; byte < 256u; ++byte) {
+    uint16_t crc = static_cast<uint16_t>(byte);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = static_cast<uint16_t>((crc & 1u) ? (crc >> 1u) ^ 0xA001u : crc >> 1u);
+    }
+    tables[0][byte] = crc;
+  }
+  for (size_t table = 1u; table < tables.size(); ++table) {
+    for (size_t byte = 0u; byte < 256u; ++byte) {
+      const uint16_t previous = tables[table - 1u][byte];
+      tables[table][byte] = static_cast<uint16_t>((previous >> 8u) ^ tables[0][previous & 0xFFu]);
+    }
+  }
+  return tables;
+}
+
+constexpr std::array<std::array<uint16_t, 256>, 8> kCrcTables = MakeCrcTables();
+
+}  // namespace
+
+std::string_view IsaName(const Isa isa) noexcept {
+  switch (isa) {
+    case Isa::kSse42:
+      return "sse4.2";
+    case Isa::kAvx2:
+      return "avx2";
+    case Isa::kAvx512:
+      return "avx512";
+    case Isa::kNeon:
+      return "neon";
+    case Isa::kSimd128:
+      return "simd128";
+    default:
+      return "scalar";
+  }
+}
+
+std::vector<Isa> SupportedIsas() {
+  std::vector<Isa> isas;
+  for (const Isa isa : {Isa::kScalar, Isa::kSse42, Isa::kAvx2, Isa::kAvx512, Isa::kNeon, Isa::kSimd128}) {
+    if (CpuSupports(isa)) {
+      isas.push_back(isa);
+    }
+  }
+  return isas;
+}
+
+const Kernels& KernelsFor(const Isa isa) {
+  if (!CpuSupports(isa)) {
+    return kScalarKernels;
+  }
+  switch (isa) {
+#if defined(FITCONVERT_X86)
+    case Isa::kSse42:
+      return kSse42Kernels;
+    case Isa::kAvx2:
+      return kAvx2Kernels;
+    case Isa::kAvx512:
+      return kAvx512Kernels;
+#elif defined(FITCONVERT_NEON)
+    case Isa::kNeon:
+      return kNeonKernels;
+#elif defined(FITCONVERT_SIMD128)
+    case Isa::kSimd128:
+      return kSimd128Kernels;
+#endif
+    default:
+      return kScalarKernels;
+  }
+}
+
+const Kernels& ActiveKernels() {
+  static const Kernels& kernels = SelectKernels();
+  return kernels;
+}
+
+uint16_t FitCrc16(const uint16_t crc, const uint8_t* data_ptr, const size_t size) noexcept {
+  uint32_t value = crc;
+  size_t index = 0u;
+  for (; index + 8u <= size; index += 8u) {
+    const uint8_t* bytes = data_ptr + index;
+    value ^= static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8u);
+    value = kCrcTables[7][value & 0xFFu] ^ kCrcTables[6][value >> 8u] ^ kCrcTables[5][bytes[2]] ^ kCrcTables[4][bytes[3]] ^
+            kCrcTables[3][bytes[4]] ^ kCrcTables[2][bytes[5]] ^ kCrcTables[1][bytes[6]] ^ kCrcTables[0][bytes[7]];
+  }
+  for (; index < size; ++index) {
+    value = (value >> 8u) ^ kCrcTables[0][(value ^ data_ptr[index]) & 0xFFu];
+  }
+  return static_cast<uint16_t>(value);
+}
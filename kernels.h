@@ -0,0 +1,83 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// instruction sets of the vectorized kernels, every kernel has a scalar reference
+enum class Isa : uint8_t {
+  kScalar,
+  kSse42,
+  kAvx2,
+  kAvx512,
+  kNeon,
+  // wasm has no runtime detection, the set is there when the module is built with -msimd128
+  kSimd128,
+};
+
+// same order as the comparisons of the record filter
+enum class CompareOp : uint8_t {
+  kLess,
+  kLessEqual,
+  kGreater,
+  kGreaterEqual,
+  kEqual,
+  kNotEqual,
+};
+
+inline constexpr size_t kCompareOps = 6u;
+
+// mask[i] = present[i] & (values[i] op threshold), NaN matches only kNotEqual
+using CompareKernel = void (*)(const double* values_ptr, const uint8_t* present_ptr, const size_t count, const double threshold, uint8_t* mask_ptr);
+// left[i] = left[i] op right[i] for masks of 0 and 1
+using MaskKernel = void (*)(uint8_t* left_ptr, const uint8_t* right_ptr, const size_t count);
+// mask[i] ^= 1
+using MaskNotKernel = void (*)(uint8_t* mask_ptr, const size_t count);
+
+struct Kernels {
+  Isa isa{Isa::kScalar};
+  std::array<CompareKernel, kCompareOps> compare{};
+  MaskKernel mask_and{nullptr};
+  MaskKernel mask_or{nullptr};
+  MaskNotKernel mask_not{nullptr};
+};
+
+// environment variable to force an instruction set for benchmarking, e.g. FITCONVERT_ISA=sse4.2
+inline constexpr std::string_view kIsaEnvironment("FITCONVERT_ISA");
+
+std::string_view IsaName(const Isa isa) noexcept;
+
+// instruction sets of this build the cpu can run, the scalar one is always first
+std::vector<Isa> SupportedIsas();
+
+// kernels of the instruction set, scalar ones when it is not supported
+const Kernels& KernelsFor(const Isa isa);
+
+// the best supported instruction set or the one forced by the environment, selected once
+const Kernels& ActiveKernels();
+
+// crc of .fit files, the same as FitCRC_Update16 of the SDK but 8 bytes per step by lookup tables
+uint16_t FitCrc16(const uint16_t crc, const uint8_t* data_ptr, const size_t size) noexcept;
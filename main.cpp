@@ -24,15 +24,33 @@
 #ifdef _WIN32
 #include <io.h>
 #endif
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <csignal>
 #include <cxxopts.hpp>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
+#include "batch.h"
 #include "datasource.h"
+#include "fit_rewrite.h"
+#include "mapped_file.h"
 #include "parser.h"
+#include "spatial_index.h"
+#include "watch.h"
 
 constexpr int kToolError{-1};
+// fitconvert watch directory and fitconvert batch directory
+constexpr std::string_view kWatchCommand{"watch"};
+constexpr std::string_view kBatchCommand{"batch"};
+
+// set by SIGINT or SIGTERM to stop watching
+std::atomic<bool> watch_stop{false};
 
 constexpr const char kBanner[] = R"%(
 
@@ -52,11 +70,18 @@ constexpr const char kBanner[] = R"%(
 
 constexpr const char kHelp[] = R"%(
 
-usage: fitconvert -i input_file -o output_file -t output_type -f offset -s N
+usage: fitconvert -i input_file -o output_file -t output_type -f offset -s N [-m [-p priorities]] [-c reference_file] [-w expression]
+       fitconvert -i directory -o library_index -t index
+       fitconvert -i library_index -o output_file -t locate -q latitude,longitude [-r radius]
+       fitconvert -i input_file -o output_file -t fit --from milliseconds --to milliseconds --compact
+       fitconvert watch directory [-o output_directory] -t output_type [--workers N] [--debounce milliseconds]
+       fitconvert batch directory [-o output_directory] -t output_type [--workers N] [--shard i/N] [--resume]
 
--i - path to .fit file to read data from
--o - path to .vtt or .json file to write to
--t - export type: vtt or json
+-i - path to .fit file to read data from, can be repeated to stitch several recordings of one activity into one timeline
+-o - path to .vtt or .json file to write to, can be repeated to write several formats from one decode
+-t - export type: vtt or json (given once for every -o or for each -o, without it several outputs take it from the .vtt or .json extension), index to build a spatial index of .fit files or directories of them, locate to find in the index
+     activities that passed the place as json (file, timestamp and offset in milliseconds from the activity start), fit to cut
+     the .fit file by --from and --to
 -f - offset in milliseconds to sync video and .fit data (optional)
 * if the offset is positive - 'offset' second of the data from .fit file will be displayed at the first second of the video.
     it is for situations when you started video after starting recording your activity(that generated .fit file)
@@ -64,38 +89,184 @@ usage: fitconvert -i input_file -o output_file -t output_type -f offset -s N
     it is for situations when you started your activity (that generated .fit file) after starting the video
 -s - smooth values by inserting N (0-5) smoothed values between timestamps (optional)
 -v - values format: metric or imperial (optional, default metric)
--d - data to process, enumerate delimited by comma (default all): speed,distance,heartrate,altitude,power,cadence,temperature
+-d - data to process, enumerate delimited by comma (default all): speed,distance,heartrate,altitude,power,cadence,temperature,
+     accelerometer,gyroscope,developer,timedelta,speeddelta,grade
+-g - data to compute when the file has none, enumerate delimited by comma or none (default speed,distance): speed and distance
+     from gps positions, grade from altitude and distance
+-e - directory with SRTM/Copernicus .hgt elevation tiles (optional), altitude is taken from them by gps position
+-m - merge inputs recorded at the same time by several devices (a watch and a bike computer) into one overlay,
+     clocks of the devices are aligned by speed or heart rate of the first input
+-p - merge priorities, data=input delimited by comma (optional, by default the first input that has the value is used):
+     power=2,cadence=2 takes power and cadence from the second input
+-c - path to .fit file of a reference ride on the same course (optional), adds time and speed gap to it at the same distance
+-w - export only the segments where the expression is true (optional): comparisons of speed, distance, heartrate, altitude,
+     power, cadence, temperature, grade, timedelta, speeddelta (or hr, alt, temp, dist) in the values format joined by && || !
+     and parentheses, "power > 400 && grade > 8"
+--pad - milliseconds of data kept before and after every matched segment (optional, default 0)
+--join - segments closer than this in milliseconds are joined into one (optional, default 0)
+--template - text of vtt cues (optional): {field} is replaced by its value in the values format, {field:precision} or
+     {field:precision:width} set the digits after the point and the width, \n is a new line, "{hr}bpm {power}W\n{speed:1}"
+--from - start of the cut .fit file in milliseconds from the first record (optional, default 0 - the beginning)
+--to - end of the cut .fit file in milliseconds from the first record (optional, default -1 - the end), messages are copied
+     without decoding and the messages without a timestamp (file id, developer fields) are kept
+--compact - rewrite the .fit file without losses: timestamps in compressed headers where they fit and definitions only when
+     they change (optional, for -t fit)
+watch - convert every .fit file written into the directory (closed after writing or moved in) to every -t type, outputs
+     are written next to it or to -o directory under a temporary name and renamed, until the process is stopped
+batch - convert every .fit file of the directory and its subdirectories to every -t type, outputs are written next to it or
+     to -o directory with the same relative path, the manifest shard-i-of-N.json lists the inputs and outputs of the shard
+--workers - number of files converted at the same time by watch and batch (optional, default 0 - number of cores)
+--debounce - milliseconds a closed file should not be written again before it is converted by watch (optional, default 50)
+--shard - i/N converts only the files of the shard i of N by a stable hash of the relative path, N nodes with shards 1/N to N/N
+     convert the whole directory without a coordinator (optional, default 1/1)
+--resume - batch skips the files converted by the previous runs of the shard according to its journal shard-i-of-N.journal,
+     the journal has a line with the size, modification time, checksum of the outputs and conversion time in microseconds for
+     every converted file (optional, without it the journal is started again)
+-q - place to locate in the index: latitude,longitude in degrees
+-r - radius of the place in meters up to 100000 (optional, default 50)
 )%";
 
+// decode tracks of all .fit files concurrently and write them as the spatial index
+int BuildIndex(const std::vector<std::string>& inputs, const std::string& output_file) {
+  const std::vector<std::filesystem::path> fit_files = CollectFitFiles(inputs);
+  SpatialIndexBuilder builder;
+  std::mutex builder_mutex;
+  std::atomic<size_t> next_file{0u};
+  auto worker = [&]() {
+    std::vector<TrackPoint> track;
+    for (size_t index = next_file++; index < fit_files.size(); index = next_file++) {
+      const std::string fit_file = fit_files[index].string();
+      try {
+        DataSourceFile data_source(fit_file);
+        if (!DecodeTrack(data_source, track)) {
+          SPDLOG_WARN("'{}' can not be decoded and is skipped", fit_file);
+          continue;
+        }
+      } catch (const std::exception& e) {
+        SPDLOG_WARN("'{}' can not be read and is skipped: {}", fit_file, e.what());
+        continue;
+      }
+      if (track.empty()) {
+        continue;
+      }
+      const std::lock_guard<std::mutex> lock(builder_mutex);
+      builder.AddTrack(fit_file, track);
+    }
+  };
+  const size_t workers_count = std::clamp<size_t>(std::thread::hardware_concurrency(), 1u, std::max<size_t>(fit_files.size(), 1u));
+  std::vector<std::thread> workers;
+  for (size_t index = 1u; index < workers_count; ++index) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  builder.Write(output_file);
+  SPDLOG_INFO("{} of {} .fit file(s) with positions are indexed", builder.GetTracks(), fit_files.size());
+  return 0;
+}
+
+// passes of the indexed activities near the place as json
+std::unique_ptr<FitResult> LocatePlace(const std::string& index_file, const std::string& place, const double radius_m) {
+  auto result = std::make_unique<FitResult>(ParseResult::kError, rapidjson::StringBuffer());
+  double latitude{0.0};
+  double longitude{0.0};
+  size_t comma = place.find(',');
+  try {
+    latitude = std::stod(place.substr(0u, comma));
+    longitude = std::stod(place.substr(comma + 1u));
+  } catch (const std::exception&) {
+    comma = std::string::npos;
+  }
+  if (comma == std::string::npos || std::abs(latitude) > 90.0 || std::abs(longitude) > 180.0) {
+    SPDLOG_ERROR("place '{}' should be latitude,longitude in degrees", place);
+    return result;
+  }
+  if (!(radius_m > 0.0 && radius_m <= SpatialIndex::kMaxRadiusM)) {
+    SPDLOG_ERROR("radius {} should be more than 0 and up to {} meters", radius_m, SpatialIndex::kMaxRadiusM);
+    return result;
+  }
+  const SpatialIndex index(index_file);
+  const std::vector<TrackPass> passes = index.Query(latitude, longitude, radius_m);
+  rapidjson::Writer<rapidjson::StringBuffer> writer(result->second);
+  writer.StartObject();
+  writer.Key("passes");
+  writer.StartArray();
+  for (const TrackPass& pass : passes) {
+    writer.StartObject();
+    writer.Key("file");
+    writer.String(pass.name.data(), static_cast<rapidjson::SizeType>(pass.name.size()));
+    writer.Key("timestamp");
+    writer.Uint(pass.timestamp);
+    writer.Key("offset");
+    writer.Int64(pass.offset);
+    writer.Key("distance");
+    writer.Double(pass.distance);
+    writer.EndObject();
+  }
+  writer.EndArray();
+  writer.EndObject();
+  SPDLOG_INFO("{} pass(es) of {} indexed activities found", passes.size(), index.GetTracks());
+  result->first = ParseResult::kSuccess;
+  return result;
+}
+
 int main(int argc, char* argv[]) {
   spdlog::set_pattern("[%H:%M:%S.%e] %^[%l]%$ %v");
   try {
     cxxopts::Options cmd_options("FIT converter", "FIT telemetry converter to .VTT or .JSON");
     cmd_options.add_options()                                                                 //
-        ("i,input", "", cxxopts::value<std::string>())                                        //
-        ("o,output", "", cxxopts::value<std::string>())                                       //
+        ("i,input", "", cxxopts::value<std::vector<std::string>>())                           //
+        ("o,output", "", cxxopts::value<std::vector<std::string>>())                          //
         ("h,help", "")                                                                        //
         ("d,data", "", cxxopts::value<std::string>()->default_value(""))                      //
-        ("t,type", "", cxxopts::value<std::string>()->default_value(kOutputVttTag.data()))    //
+        ("t,type", "", cxxopts::value<std::vector<std::string>>()->default_value(kOutputVttTag.data()))  //
         ("f,offset", "", cxxopts::value<int64_t>()->default_value("0"))                         //
         ("v,values", "", cxxopts::value<std::string>()->default_value(kValuesMetric.data()))  //
-        ("s,smooth", "", cxxopts::value<uint8_t>()->default_value("0"));                        //
-    const auto cmd_result = cmd_options.parse(argc, argv);
+        ("s,smooth", "", cxxopts::value<uint8_t>()->default_value("0"))                         //
+        ("m,merge", "")                                                                       //
+        ("p,priorities", "", cxxopts::value<std::string>()->default_value(""))                //
+        ("c,compare", "", cxxopts::value<std::string>()->default_value(""))                   //
+        ("g,derive", "", cxxopts::value<std::string>()->default_value(std::string(kDeriveDefault)))  //
+        ("e,elevation", "", cxxopts::value<std::string>()->default_value(""))                 //
+        ("w,where", "", cxxopts::value<std::string>()->default_value(""))                     //
+        ("pad", "", cxxopts::value<int64_t>()->default_value("0"))                            //
+        ("join", "", cxxopts::value<int64_t>()->default_value("0"))                           //
+        ("template", "", cxxopts::value<std::string>()->default_value(""))                    //
+        ("from", "", cxxopts::value<int64_t>()->default_value("0"))                           //
+        ("to", "", cxxopts::value<int64_t>()->default_value("-1"))                            //
+        ("compact", "")                                                                       //
+        ("workers", "", cxxopts::value<size_t>()->default_value("0"))                         //
+        ("debounce", "", cxxopts::value<int64_t>()->default_value("50"))                      //
+        ("shard", "", cxxopts::value<std::string>()->default_value("1/1"))                    //
+        ("resume", "")                                                                        //
+        ("q,place", "", cxxopts::value<std::string>()->default_value(""))                     //
+        ("r,radius", "", cxxopts::value<double>()->default_value("50"));                      //
+    // the directory of watch and batch is the input and -o is optional
+    const std::string_view command = argc > 1 && (kWatchCommand == argv[1] || kBatchCommand == argv[1]) ? argv[1] : "";
+    if (!command.empty()) {
+      cmd_options.parse_positional({"input"});
+    }
+    const auto cmd_result = command.empty() ? cmd_options.parse(argc, argv) : cmd_options.parse(argc - 1, argv + 1);
 
-    if (argc < 2 || cmd_result.count("help") > 0 || cmd_result.count("input") == 0 || cmd_result.count("output") == 0) {
+    if (argc < 2 || cmd_result.count("help") > 0 || cmd_result.count("input") == 0 || (command.empty() && cmd_result.count("output") == 0)) {
       std::cout << kBanner << std::endl;
       std::cout << kHelp << std::endl;
     }
 
-    const std::string input_fit_file(cmd_result["input"].as<std::string>());
-    const std::string output_file(cmd_result["output"].as<std::string>());
-    const std::string output_type(cmd_result["type"].as<std::string>());
+    const std::vector<std::string> input_fit_files(cmd_result["input"].as<std::vector<std::string>>());
+    const std::vector<std::string> output_files(cmd_result.count("output") > 0 ? cmd_result["output"].as<std::vector<std::string>>()
+                                                                               : std::vector<std::string>());
+    const std::vector<std::string> types(cmd_result["type"].as<std::vector<std::string>>());
     const int64_t offset(cmd_result["offset"].as<int64_t>());
     const uint8_t smoothness(cmd_result["smooth"].as<uint8_t>());
     const std::string datatypes(cmd_result["data"].as<std::string>());
     const std::string values(cmd_result["values"].as<std::string>());
+    const std::string reference_fit_file(cmd_result["compare"].as<std::string>());
 
-    if (output_file == kStdoutTag) {
+    const auto stdout_outputs = std::count(output_files.begin(), output_files.end(), kStdoutTag);
+    if (stdout_outputs > 0) {
       // disable informative output for cou output
       spdlog::set_level(spdlog::level::err);
 #ifdef _WIN32
@@ -104,17 +275,87 @@ int main(int argc, char* argv[]) {
     } else {
       spdlog::set_level(spdlog::level::info);
     }
+    const auto stdin_inputs = std::count(input_fit_files.begin(), input_fit_files.end(), kStdinTag);
 #ifdef _WIN32
-    if (input_fit_file == kStdinTag) {
+    if (stdin_inputs > 0) {
       (void)_setmode(_fileno(stdin), _O_BINARY);
     }
 #endif
 
-    if (output_type != kOutputJsonTag && output_type != kOutputVttTag) {
-      SPDLOG_ERROR("unknown type format specified: '{}, only 'vtt' or 'json' is supported", output_type);
+    if (stdin_inputs > 1) {
+      SPDLOG_ERROR("stdin can be used only once as input");
+      return kToolError;
+    }
+
+    if (stdout_outputs > 1) {
+      SPDLOG_ERROR("stdout can be used only once as output");
+      return kToolError;
+    }
+
+    // -t given once is the type of every -o, -t for every -o is its type, without -t several outputs take it from the file extension
+    // watch and batch write every type for every file
+    std::vector<std::string> output_types;
+    const bool types_given = cmd_result.count("type") > 0;
+    if (!command.empty()) {
+      output_types = types;
+      if (input_fit_files.size() != 1u || output_files.size() > 1u || !std::filesystem::is_directory(input_fit_files.front())) {
+        SPDLOG_ERROR("{} needs one directory and one output directory (optional)", command);
+        return kToolError;
+      }
+    }
+    for (size_t index = 0u; command.empty() && index < output_files.size(); ++index) {
+      const std::string extension = std::filesystem::path(output_files[index]).extension().string();
+      if (types_given && types.size() == output_files.size()) {
+        output_types.push_back(types[index]);
+      } else if (types_given && types.size() == 1u) {
+        output_types.push_back(types.front());
+      } else if (types_given) {
+        SPDLOG_ERROR("-t should be given once or for every output");
+        return kToolError;
+      } else if (output_files.size() == 1u) {
+        // the default type
+        output_types.push_back(types.front());
+      } else if (extension == ".vtt" || extension == ".json") {
+        output_types.push_back(extension.substr(1u));
+      } else {
+        SPDLOG_ERROR("type of '{}' can not be taken from its extension, only .vtt or .json, -t should be given", output_files[index]);
+        return kToolError;
+      }
+    }
+
+    if (output_types.empty()) {
+      SPDLOG_ERROR("no output is given");
       return kToolError;
     }
 
+    for (const std::string& output_type : output_types) {
+      if (output_type != kOutputJsonTag && output_type != kOutputVttTag && output_type != kOutputIndexTag && output_type != kOutputLocateTag &&
+          output_type != kOutputFitTag) {
+        SPDLOG_ERROR("unknown type format specified: '{}, only 'vtt', 'json', 'index', 'locate' or 'fit' is supported", output_type);
+        return kToolError;
+      }
+      if ((output_type == kOutputIndexTag || output_type == kOutputLocateTag || output_type == kOutputFitTag) && output_types.size() > 1u) {
+        SPDLOG_ERROR("'{}' type can be used only with one output", output_type);
+        return kToolError;
+      }
+      if (!command.empty() && output_type != kOutputJsonTag && output_type != kOutputVttTag) {
+        SPDLOG_ERROR("{} converts to 'vtt' or 'json'", command);
+        return kToolError;
+      }
+      if (output_type == kOutputFitTag && input_fit_files.size() > 1u) {
+        SPDLOG_ERROR("'{}' type cuts one input", output_type);
+        return kToolError;
+      }
+    }
+
+    if (output_types.front() == kOutputIndexTag) {
+      if (stdin_inputs > 0 || stdout_outputs > 0) {
+        SPDLOG_ERROR("index is built from files to a file");
+        return kToolError;
+      }
+      return BuildIndex(input_fit_files, output_files.front());
+    }
+
     if (values != kValuesMetric && values != kValuesImperial) {
       SPDLOG_ERROR("unknown values format specified: '{}, only 'metric' or 'imperial' is supported", values);
       return kToolError;
@@ -130,20 +371,107 @@ int main(int argc, char* argv[]) {
       return kToolError;
     }
 
-    std::unique_ptr<DataSource> data_source;
-    size_t data_source_size{0};
-    if (kStdinTag == input_fit_file) {
-      data_source = std::make_unique<DataSourceStdin>();
-    } else {
-      data_source = std::make_unique<DataSourceFile>(input_fit_file);
+    uint32_t derive_data_types{0u};
+    if (!DeriveNamesToMask(cmd_result["derive"].as<std::string>(), derive_data_types)) {
+      SPDLOG_ERROR("unknown data to compute: '{}', only speed, distance, grade or none is supported", cmd_result["derive"].as<std::string>());
+      return kToolError;
+    }
+
+    // options are made for every conversion of watch and batch
+    auto make_options = [&cmd_result, &reference_fit_file, derive_data_types]() {
+      ConvertOptions options;
+      options.inputs_mode = cmd_result.count("merge") > 0 ? InputsMode::kMerge : InputsMode::kStitch;
+      options.merge_priorities = cmd_result["priorities"].as<std::string>();
+      options.derive_data_types = derive_data_types;
+      options.elevation_directory = cmd_result["elevation"].as<std::string>();
+      options.where = cmd_result["where"].as<std::string>();
+      options.where_pad_ms = cmd_result["pad"].as<int64_t>();
+      options.where_join_ms = cmd_result["join"].as<int64_t>();
+      options.cue_template = cmd_result["template"].as<std::string>();
+      if (!reference_fit_file.empty()) {
+        options.reference_source = std::make_unique<DataSourceFile>(reference_fit_file);
+      }
+      return options;
+    };
+
+    if (!command.empty()) {
+      const std::filesystem::path directory(input_fit_files.front());
+      const std::filesystem::path output_directory(output_files.empty() ? directory : std::filesystem::path(output_files.front()));
+      const std::vector<std::string_view> convert_types(output_types.begin(), output_types.end());
+      // outputs are output_file with the extension of every type
+      auto convert = [&](const std::filesystem::path& fit_file, const std::filesystem::path& output_file) {
+        std::vector<std::unique_ptr<DataSource>> fit_sources;
+        fit_sources.push_back(std::make_unique<DataSourceFile>(fit_file.string()));
+        const auto file_results =
+            Convert(std::move(fit_sources), convert_types, offset, smoothness, datatypes_mask, values == kValuesImperial, make_options());
+        for (const auto& result : file_results) {
+          if (result->first != ParseResult::kSuccess) {
+            SPDLOG_WARN("'{}' can not be converted", fit_file.string());
+            return false;
+          }
+        }
+        for (size_t index = 0u; index < file_results.size(); ++index) {
+          WriteFileAtomically(std::filesystem::path(output_file).replace_extension(output_types[index]), file_results[index]->second.GetString(),
+                              file_results[index]->second.GetSize());
+        }
+        return true;
+      };
+      const size_t workers = cmd_result["workers"].as<size_t>() > 0u ? cmd_result["workers"].as<size_t>()
+                                                                      : std::max(std::thread::hardware_concurrency(), 1u);
+      if (command == kBatchCommand) {
+        Shard shard;
+        if (!ParseShard(cmd_result["shard"].as<std::string>(), shard)) {
+          SPDLOG_ERROR("shard '{}' should be i/N with i from 1 to N", cmd_result["shard"].as<std::string>());
+          return kToolError;
+        }
+        return ConvertBatch(directory, output_directory, output_types, shard, workers, cmd_result.count("resume") > 0, convert) ? 0 : kToolError;
+      }
+      std::signal(SIGINT, [](int) { watch_stop = true; });
+      std::signal(SIGTERM, [](int) { watch_stop = true; });
+      return WatchDirectory(directory, workers, cmd_result["debounce"].as<int64_t>(), watch_stop,
+                            [&](const std::filesystem::path& fit_file) { convert(fit_file, output_directory / fit_file.filename()); })
+                 ? 0
+                 : kToolError;
+    }
+
+    std::vector<std::unique_ptr<DataSource>> data_sources;
+    for (const std::string& input_fit_file : input_fit_files) {
+      if (kStdinTag == input_fit_file) {
+        data_sources.push_back(std::make_unique<DataSourceStdin>());
+      } else {
+        data_sources.push_back(std::make_unique<DataSourceFile>(input_fit_file));
+      }
     }
 
-    const std::unique_ptr<FitResult> result =
-        Convert(std::move(data_source), output_type, offset, smoothness, datatypes_mask, values == kValuesImperial);
-    if (result->first == ParseResult::kSuccess) {
+    ConvertOptions options = make_options();
+
+    std::vector<std::unique_ptr<FitResult>> results;
+    // messages of the cut are copied from the mapped input
+    std::unique_ptr<MappedFile> mapped_input;
+    if (output_types.front() == kOutputLocateTag) {
+      results.push_back(LocatePlace(input_fit_files.front(), cmd_result["place"].as<std::string>(), cmd_result["radius"].as<double>()));
+    } else if (output_types.front() == kOutputFitTag) {
+      if (kStdinTag != input_fit_files.front()) {
+        mapped_input = std::make_unique<MappedFile>(input_fit_files.front());
+        data_sources.front() = std::make_unique<DataSourceMemory>(mapped_input->GetData(), mapped_input->GetSize());
+      }
+      results.push_back(
+          TrimFit(*data_sources.front(), cmd_result["from"].as<int64_t>(), cmd_result["to"].as<int64_t>(), cmd_result.count("compact") > 0));
+    } else {
+      // one decode for all outputs
+      const std::vector<std::string_view> convert_types(output_types.begin(), output_types.end());
+      results = Convert(std::move(data_sources), convert_types, offset, smoothness, datatypes_mask, values == kValuesImperial, std::move(options));
+    }
+    for (size_t index = 0u; index < results.size(); ++index) {
+      const std::unique_ptr<FitResult>& result = results[index];
+      const std::string& output_file = output_files[index];
+      if (result->first != ParseResult::kSuccess) {
+        SPDLOG_ERROR(".fit file problem during processing");
+        return kToolError;
+      }
       if (kStdoutTag == output_file) {
         std::cout.write(result->second.GetString(), result->second.GetSize());
-        if (result->second.GetSize()) {
+        if (result->second.GetSize() == 0u) {
           SPDLOG_ERROR("result is empty");
         }
       } else {
@@ -152,9 +480,6 @@ int main(int argc, char* argv[]) {
         output_stream.exceptions(std::ios_base::badbit);
         output_stream.write(result->second.GetString(), result->second.GetSize());
       }
-    } else {
-      SPDLOG_ERROR(".fit file problem during processing");
-      return kToolError;
     }
   } catch (const std::ios_base::failure& fail) {
     SPDLOG_ERROR("file problem during processing: {}", fail.what());
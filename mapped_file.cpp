@@ -0,0 +1,103 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "mapped_file.h"
+
+#include <cerrno>
+#include <system_error>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+  file_handle_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle_ == INVALID_HANDLE_VALUE) {
+    file_handle_ = nullptr;
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), path.string());
+  }
+  LARGE_INTEGER file_size;
+  GetFileSizeEx(file_handle_, &file_size);
+  size_ = static_cast<size_t>(file_size.QuadPart);
+  if (size_ == 0u) {
+    return;
+  }
+  mapping_handle_ = CreateFileMappingW(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping_handle_ == nullptr) {
+    CloseHandle(file_handle_);
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), path.string());
+  }
+  data_ptr_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+  if (data_ptr_ == nullptr) {
+    CloseHandle(mapping_handle_);
+    CloseHandle(file_handle_);
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), path.string());
+  }
+#else
+  const int file_descriptor = open(path.c_str(), O_RDONLY);
+  if (file_descriptor < 0) {
+    throw std::system_error(errno, std::generic_category(), path.string());
+  }
+  struct stat file_stat {};
+  if (fstat(file_descriptor, &file_stat) != 0) {
+    const int error = errno;
+    close(file_descriptor);
+    throw std::system_error(error, std::generic_category(), path.string());
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+  if (size_ > 0u) {
+    void* mapped_ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapped_ptr == MAP_FAILED) {
+      const int error = errno;
+      close(file_descriptor);
+      throw std::system_error(error, std::generic_category(), path.string());
+    }
+    data_ptr_ = static_cast<const uint8_t*>(mapped_ptr);
+  }
+  // the mapping stays valid after the descriptor is closed
+  close(file_descriptor);
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+  if (data_ptr_ != nullptr) {
+    UnmapViewOfFile(data_ptr_);
+  }
+  if (mapping_handle_ != nullptr) {
+    CloseHandle(mapping_handle_);
+  }
+  if (file_handle_ != nullptr) {
+    CloseHandle(file_handle_);
+  }
+#else
+  if (data_ptr_ != nullptr) {
+    munmap(const_cast<uint8_t*>(data_ptr_), size_);
+  }
+#endif
+}
@@ -24,16 +24,31 @@
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cctype>
 #include <charconv>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "datasource.h"
+#include "dem.h"
 #include "fitsdk/fit_convert.h"
+#include "kernels.h"
 
 namespace {
 
@@ -41,6 +56,8 @@ constexpr std::string_view kVttHeaderTag("WEBVTT\n\n");
 constexpr std::string_view kVttTimeSeparator(" --> ");
 constexpr std::string_view kVttOffsetMessage("\n< .fit data is not yet available >");
 constexpr std::string_view kVttEndMessage("\n< no more .fit data >");
+constexpr std::string_view kVttGapMessage("\n< .fit recording was stopped >");
+constexpr std::string_view kVttPauseMessage("\n< .fit timer was paused >");
 constexpr std::string_view kVttMessage("\nmade with ❤️ by fitconvert\n\n");
 
 // adapter for fmt::format_to to write directly into a RapidJSON StringBuffer
@@ -120,6 +137,12 @@ enum DataType : uint32_t {
   kTypeLatitude = 8,
   kTypeLongitude = 9,
   kTypeTimeStampNext = 10,
+  kTypeAccelerometer = 11,
+  kTypeGyroscope = 12,
+  kTypeDeveloper = 13,
+  kTypeTimeDelta = 14,
+  kTypeSpeedDelta = 15,
+  kTypeGrade = 16,
   // always should be at the end
   kTypeMax,
 };
@@ -129,17 +152,23 @@ constexpr uint32_t DataTypeToMask(const DataType type) {
 };
 
 constexpr std::array<uint32_t, DataType::kTypeMax> kDataTypeMasks = {
-    DataTypeToMask(kTypeSpeed),         // kTypeSpeed
-    DataTypeToMask(kTypeDistance),      // kTypeDistance
-    DataTypeToMask(kTypeHeartRate),     // kTypeHeartRate
-    DataTypeToMask(kTypeAltitude),      // kTypeAltitude
-    DataTypeToMask(kTypePower),         // kTypePower
-    DataTypeToMask(kTypeCadence),       // kTypeCadence
-    DataTypeToMask(kTypeTemperature),   // kTypeTemperature
-    DataTypeToMask(kTypeTimeStamp),     // kTypeTimeStamp
-    DataTypeToMask(kTypeLatitude),      // kTypeLatitude
-    DataTypeToMask(kTypeLongitude),     // kTypeLongitude
-    DataTypeToMask(kTypeTimeStampNext)  // kTypeTimeStampNext
+    DataTypeToMask(kTypeSpeed),          // kTypeSpeed
+    DataTypeToMask(kTypeDistance),       // kTypeDistance
+    DataTypeToMask(kTypeHeartRate),      // kTypeHeartRate
+    DataTypeToMask(kTypeAltitude),       // kTypeAltitude
+    DataTypeToMask(kTypePower),          // kTypePower
+    DataTypeToMask(kTypeCadence),        // kTypeCadence
+    DataTypeToMask(kTypeTemperature),    // kTypeTemperature
+    DataTypeToMask(kTypeTimeStamp),      // kTypeTimeStamp
+    DataTypeToMask(kTypeLatitude),       // kTypeLatitude
+    DataTypeToMask(kTypeLongitude),      // kTypeLongitude
+    DataTypeToMask(kTypeTimeStampNext),  // kTypeTimeStampNext
+    DataTypeToMask(kTypeAccelerometer),  // kTypeAccelerometer
+    DataTypeToMask(kTypeGyroscope),      // kTypeGyroscope
+    DataTypeToMask(kTypeDeveloper),      // kTypeDeveloper
+    DataTypeToMask(kTypeTimeDelta),      // kTypeTimeDelta
+    DataTypeToMask(kTypeSpeedDelta),     // kTypeSpeedDelta
+    DataTypeToMask(kTypeGrade)           // kTypeGrade
 };
 
 constexpr std::array<std::pair<std::string_view, std::string_view>, DataType::kTypeMax> kDataTypes = {
@@ -153,7 +182,13 @@ constexpr std::array<std::pair<std::string_view, std::string_view>, DataType::kT
      {"timestamp", "f"},      // kTypeTimeStamp
      {"latitude", "u"},       // kTypeLatitude
      {"longitude", "o"},      // kTypeLongitude
-     {"timestampnext", "n"}}  // kTypeTimeStampNext
+     {"timestampnext", "n"},  // kTypeTimeStampNext
+     {"accelerometer", "x"},  // kTypeAccelerometer
+     {"gyroscope", "g"},      // kTypeGyroscope
+     {"developer", "v"},      // kTypeDeveloper
+     {"timedelta", "e"},      // kTypeTimeDelta
+     {"speeddelta", "w"},     // kTypeSpeedDelta
+     {"grade", "r"}}          // kTypeGrade
 };
 
 using FormatData = std::array<std::pair<std::string_view, size_t>, DataType::kTypeMax>;
@@ -169,7 +204,13 @@ constexpr FormatData kMetricFormat = {
      {"", 0},        // kTypeTimeStamp
      {"", 0},        // kTypeLatitude
      {"", 0},        // kTypeLongitude
-     {"", 0}}        // kTypeTimeStampNext
+     {"", 0},        // kTypeTimeStampNext
+     {"", 0},        // kTypeAccelerometer
+     {"", 0},        // kTypeGyroscope
+     {"", 0},        // kTypeDeveloper
+     {" s ⏱", 0},     // kTypeTimeDelta seconds
+     {" km/h Δ", 0},   // kTypeSpeedDelta km/h
+     {"% ⛰", 0}}       // kTypeGrade percent
 };
 
 constexpr FormatData kImperialFormat = {
@@ -183,7 +224,13 @@ constexpr FormatData kImperialFormat = {
      {"", 0},        // kTypeTimeStamp
      {"", 0},        // kTypeLatitude
      {"", 0},        // kTypeLongitude
-     {"", 0}}        // kTypeTimeStampNext
+     {"", 0},        // kTypeTimeStampNext
+     {"", 0},        // kTypeAccelerometer
+     {"", 0},        // kTypeGyroscope
+     {"", 0},        // kTypeDeveloper
+     {" s ⏱", 0},     // kTypeTimeDelta seconds
+     {" mp/h Δ", 0},   // kTypeSpeedDelta mp/h
+     {"% ⛰", 0}}       // kTypeGrade percent
 };
 
 struct Time {
@@ -215,6 +262,16 @@ DataType NameToDataType(std::string_view name) {
   return DataType::kTypeMax;
 };
 
+// field of --template and --where: data type name or its short alias
+DataType FieldNameToDataType(const std::string_view name) {
+  constexpr std::array<std::pair<std::string_view, DataType>, 4> kAliases = {{{"hr", DataType::kTypeHeartRate},
+                                                                              {"alt", DataType::kTypeAltitude},
+                                                                              {"temp", DataType::kTypeTemperature},
+                                                                              {"dist", DataType::kTypeDistance}}};
+  const auto alias = std::find_if(kAliases.begin(), kAliases.end(), [name](const auto& entry) { return entry.first == name; });
+  return alias != kAliases.end() ? alias->second : NameToDataType(name);
+}
+
 template <typename T>
 size_t format_value_suffix(T value,                        //
                            char* buffer_ptr,               //
@@ -318,6 +375,464 @@ size_t format_timestamp(char* buffer_ptr, const size_t buffer_size, const Time&
   return static_cast<size_t>(ptr - buffer_ptr);
 }
 
+// cue with a message instead of values
+void WriteVttCue(OutputBuffer& write_buffer, const int64_t from_ms, const int64_t to_ms, const std::string_view message) {
+  const Time start(from_ms);
+  const Time end(to_ms);
+  std::array<char, 32> formatting_buffer;
+  const size_t size_start = format_timestamp(formatting_buffer.data(), formatting_buffer.size(), start);
+  write_buffer.AppendString(formatting_buffer.data(), size_start);
+  write_buffer.AppendString(kVttTimeSeparator);
+  const size_t size_end = format_timestamp(formatting_buffer.data(), formatting_buffer.size(), end);
+  write_buffer.AppendString(formatting_buffer.data(), size_end);
+  write_buffer.AppendString(message);
+  write_buffer.AppendString(kVttMessage);
+}
+
+// stored value = output value * scale + shift
+bool OutputUnits(const DataType type, const bool imperial, double& scale, double& shift) {
+  shift = 0.0;
+  switch (type) {
+    case DataType::kTypeSpeed:
+    case DataType::kTypeSpeedDelta:
+      // mm/s
+      scale = imperial ? 447.2136 : 277.77;
+      return true;
+    case DataType::kTypeDistance:
+      // cm
+      scale = imperial ? 160934.4 : 100000.0;
+      return true;
+    case DataType::kTypeAltitude:
+      // 5 * m + 500
+      scale = imperial ? 5.0 / 3.28084 : 5.0;
+      shift = 2500.0;
+      return true;
+    case DataType::kTypeTemperature:
+      scale = imperial ? 5.0 / 9.0 : 1.0;
+      shift = imperial ? -32.0 * 5.0 / 9.0 : 0.0;
+      return true;
+    case DataType::kTypeGrade:
+      // 100 * %
+      scale = 100.0;
+      return true;
+    case DataType::kTypeTimeDelta:
+      // ms
+      scale = 1000.0;
+      return true;
+    case DataType::kTypeHeartRate:
+    case DataType::kTypePower:
+    case DataType::kTypeCadence:
+      scale = 1.0;
+      return true;
+    default:
+      return false;
+  }
+}
+
+// --template: layout of the vtt cue text, "{hr}bpm {power}W\n{speed:1}", compiled once into literal copies and field formatters
+class CueTemplate {
+ public:
+  enum class Kind : uint8_t {
+    kLiteral,
+    kValue,
+    kDeveloper,
+  };
+
+  struct Instruction {
+    Kind kind{Kind::kLiteral};
+    DataType type{DataType::kTypeMax};
+    uint8_t precision{0u};
+    // padded with spaces on the left
+    uint8_t width{0u};
+    // sign is shown for the differences to the reference
+    bool sign{false};
+    // literal in the pool
+    uint32_t offset{0u};
+    uint32_t size{0u};
+    // output value = stored value * scale + shift
+    double scale{1.0};
+    double shift{0.0};
+  };
+
+  bool Compile(const std::string_view layout, const bool imperial) {
+    instructions_.clear();
+    literals_.clear();
+    for (size_t position = 0u; position < layout.size(); ++position) {
+      const char symbol = layout[position];
+      if (symbol == '\\' && position + 1u < layout.size() && layout[position + 1u] == 'n') {
+        AppendLiteral('\n');
+        ++position;
+      } else if ((symbol == '{' || symbol == '}') && position + 1u < layout.size() && layout[position + 1u] == symbol) {
+        AppendLiteral(symbol);
+        ++position;
+      } else if (symbol == '{') {
+        const size_t end = layout.find('}', position);
+        if (end == std::string_view::npos || !AppendField(layout.substr(position + 1u, end - position - 1u), imperial)) {
+          return false;
+        }
+        position = end;
+      } else if (symbol == '}') {
+        return false;
+      } else {
+        AppendLiteral(symbol);
+      }
+    }
+    return true;
+  }
+
+  bool Empty() const noexcept { return instructions_.empty(); }
+
+  const std::vector<Instruction>& GetInstructions() const noexcept { return instructions_; }
+
+  std::string_view GetLiteral(const Instruction& instruction) const noexcept {
+    return std::string_view(literals_).substr(instruction.offset, instruction.size);
+  }
+
+  // shown when the record has no value of the field
+  static constexpr std::string_view kNoValue = "--";
+
+ private:
+  // consecutive literal symbols are copied by one instruction
+  void AppendLiteral(const char symbol) {
+    if (instructions_.empty() || instructions_.back().kind != Kind::kLiteral) {
+      Instruction& instruction = instructions_.emplace_back();
+      instruction.offset = static_cast<uint32_t>(literals_.size());
+    }
+    literals_.push_back(symbol);
+    ++instructions_.back().size;
+  }
+
+  // name, name:precision or name:precision:width
+  bool AppendField(const std::string_view field, const bool imperial) {
+    const size_t colon = field.find(':');
+    const DataType type = FieldNameToDataType(field.substr(0u, colon));
+    Instruction instruction;
+    instruction.type = type;
+    if (type == DataType::kTypeDeveloper && colon == std::string_view::npos) {
+      instruction.kind = Kind::kDeveloper;
+      instructions_.push_back(instruction);
+      return true;
+    }
+    double scale{1.0};
+    double shift{0.0};
+    if (type == DataType::kTypeMax || !OutputUnits(type, imperial, scale, shift)) {
+      return false;
+    }
+    instruction.kind = Kind::kValue;
+    instruction.scale = 1.0 / scale;
+    instruction.shift = -shift / scale;
+    instruction.sign = type == DataType::kTypeTimeDelta || type == DataType::kTypeSpeedDelta;
+    instruction.precision = kDefaultPrecision[type];
+    if (colon != std::string_view::npos) {
+      const std::string_view format = field.substr(colon + 1u);
+      const size_t width_colon = format.find(':');
+      if (!ParseNumber(format.substr(0u, width_colon), kMaxPrecision, instruction.precision) ||
+          (width_colon != std::string_view::npos && !ParseNumber(format.substr(width_colon + 1u), kMaxWidth, instruction.width))) {
+        return false;
+      }
+    }
+    instructions_.push_back(instruction);
+    return true;
+  }
+
+  static bool ParseNumber(const std::string_view text, const uint8_t max_value, uint8_t& value) {
+    const auto [end_ptr, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc() && end_ptr == text.data() + text.size() && value <= max_value;
+  }
+
+  // the same as the fixed layout
+  static constexpr std::array<uint8_t, DataType::kTypeMax> kDefaultPrecision = {1u, 2u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u};
+  static constexpr uint8_t kMaxPrecision = 6u;
+  static constexpr uint8_t kMaxWidth = 16u;
+
+  std::vector<Instruction> instructions_;
+  std::string literals_;
+};
+
+// developer field from field_description, value = raw / scale - offset
+struct DeveloperField {
+  uint8_t developer_data_index{0u};
+  uint8_t field_definition_number{0u};
+  uint8_t base_type{FIT_BASE_TYPE_UINT8};
+  uint8_t precision{0u};
+  double scale{1.0};
+  double offset{0.0};
+  std::string name;
+  std::string units;
+  // units formatted for vtt
+  std::string suffix;
+};
+
+// developer field bytes in the developer data of a message, compiled once per definition
+struct DeveloperFieldView {
+  uint16_t offset{0u};
+  uint16_t column{0u};
+  uint8_t base_type{FIT_BASE_TYPE_UINT8};
+  uint8_t size{0u};
+};
+
+// registry of developer fields (Connect IQ) and their values as dense columns indexed by record
+class DeveloperFields {
+ public:
+  void ApplyDeveloper(const FIT_DEVELOPER_DATA_ID_MESG* developer_ptr) {
+    if (developer_ptr->developer_data_index == FIT_UINT8_INVALID) {
+      return;
+    }
+    std::string& application = applications_[developer_ptr->developer_data_index];
+    application.clear();
+    if (std::all_of(std::begin(developer_ptr->application_id), std::end(developer_ptr->application_id), [](const FIT_BYTE value) {
+          return value == FIT_BYTE_INVALID;
+        })) {
+      return;
+    }
+    for (const FIT_BYTE value : developer_ptr->application_id) {
+      fmt::format_to(std::back_inserter(application), "{:02x}", value);
+    }
+  }
+
+  void ApplyDescription(const FIT_FIELD_DESCRIPTION_MESG* description_ptr) {
+    if (description_ptr->developer_data_index == FIT_UINT8_INVALID || description_ptr->field_definition_number == FIT_UINT8_INVALID) {
+      return;
+    }
+    const size_t index = FindField(description_ptr->developer_data_index, description_ptr->field_definition_number);
+    if (index == fields_.size()) {
+      fields_.emplace_back();
+      columns_.emplace_back();
+    }
+    DeveloperField& field = fields_[index];
+    field.developer_data_index = description_ptr->developer_data_index;
+    field.field_definition_number = description_ptr->field_definition_number;
+    field.base_type = description_ptr->fit_base_type_id;
+    field.scale = (description_ptr->scale == FIT_UINT8_INVALID || description_ptr->scale == 0u) ? 1.0 : description_ptr->scale;
+    field.offset = (description_ptr->offset == FIT_SINT8_INVALID) ? 0.0 : description_ptr->offset;
+    const bool is_float = (field.base_type == FIT_BASE_TYPE_FLOAT32 || field.base_type == FIT_BASE_TYPE_FLOAT64);
+    field.precision = (is_float || field.scale >= 100.0) ? 2u : (field.scale >= 10.0 ? 1u : 0u);
+    field.units.assign(description_ptr->units, strnlen(description_ptr->units, sizeof(description_ptr->units)));
+    field.suffix = fmt::format(" {} ", field.units);
+    std::string name(description_ptr->field_name, strnlen(description_ptr->field_name, sizeof(description_ptr->field_name)));
+    if (name.empty()) {
+      name = fmt::format("developer_{}_{}", field.developer_data_index, field.field_definition_number);
+    }
+    // field names are used as json keys, the same name can come from different applications
+    for (const DeveloperField& other : fields_) {
+      if (&other != &field && other.name == name) {
+        name = fmt::format("{}_{}", name, field.developer_data_index);
+        break;
+      }
+    }
+    field.name = std::move(name);
+    ++registry_version_;
+  }
+
+  // copy developer field values of the current message into the row, false if there were none
+  bool ApplyData(const size_t row,
+                 const FIT_CONVERT_DEV_FIELD* dev_fields_ptr,
+                 const uint8_t dev_fields_count,
+                 const FIT_UINT8* dev_data_ptr,
+                 const FIT_UINT8 arch) {
+    if (dev_fields_count == 0u) {
+      return false;
+    }
+    const bool swap = (arch & FIT_ARCH_ENDIAN_MASK) != (FIT_ARCH_ENDIAN & FIT_ARCH_ENDIAN_MASK);
+    auto same_field = [](const FIT_CONVERT_DEV_FIELD& left, const FIT_CONVERT_DEV_FIELD& right) {
+      return left.offset == right.offset && left.num == right.num && left.size == right.size &&
+             left.developer_data_index == right.developer_data_index;
+    };
+    if (plan_version_ != registry_version_ || plan_swap_ != swap || plan_definition_.size() != dev_fields_count ||
+        !std::equal(plan_definition_.begin(), plan_definition_.end(), dev_fields_ptr, same_field)) {
+      Compile(dev_fields_ptr, dev_fields_count, swap);
+    }
+    bool applied{false};
+    for (const DeveloperFieldView& view : plan_) {
+      double value{0.0};
+      if (!ReadValue(dev_data_ptr + view.offset, view, value)) {
+        continue;
+      }
+      std::vector<double>& column = columns_[view.column];
+      if (column.size() <= row) {
+        column.resize(row + 1u, std::numeric_limits<double>::quiet_NaN());
+      }
+      column[row] = value / fields_[view.column].scale - fields_[view.column].offset;
+      applied = true;
+    }
+    return applied;
+  }
+
+  bool HasValues() const noexcept {
+    return std::any_of(columns_.begin(), columns_.end(), [](const std::vector<double>& column) { return !column.empty(); });
+  }
+
+  void ExportToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer, const size_t row) const {
+    for (size_t column = 0u; column < columns_.size(); ++column) {
+      if (row < columns_[column].size() && !std::isnan(columns_[column][row])) {
+        writer.Key(fields_[column].name.data(), static_cast<rapidjson::SizeType>(fields_[column].name.size()));
+        writer.Double(columns_[column][row]);
+      }
+    }
+  }
+
+  void ExportToVtt(OutputBuffer& writer, const size_t row) const {
+    std::array<char, 64u> formatting_buffer;
+    for (size_t column = 0u; column < columns_.size(); ++column) {
+      if (row < columns_[column].size() && !std::isnan(columns_[column][row])) {
+        const DeveloperField& field = fields_[column];
+        writer.Put(' ');
+        const size_t size = format_value_suffix(
+            columns_[column][row], formatting_buffer.data(), formatting_buffer.size(), 0u, field.suffix, field.precision);
+        writer.AppendString(formatting_buffer.data(), size);
+      }
+    }
+  }
+
+  // append fields of a chained file, its rows start from row_offset
+  void Append(const DeveloperFields& other, const size_t row_offset) {
+    for (size_t other_column = 0u; other_column < other.columns_.size(); ++other_column) {
+      const std::vector<double>& other_values = other.columns_[other_column];
+      if (other_values.empty()) {
+        continue;
+      }
+      const DeveloperField& other_field = other.fields_[other_column];
+      // the same field can have another developer_data_index in another file, so it's matched by name
+      const auto found = std::find_if(
+          fields_.begin(), fields_.end(), [&other_field](const DeveloperField& field) { return field.name == other_field.name; });
+      const size_t column = static_cast<size_t>(found - fields_.begin());
+      if (found == fields_.end()) {
+        fields_.push_back(other_field);
+        columns_.emplace_back();
+      }
+      if (applications_[fields_[column].developer_data_index].empty()) {
+        applications_[fields_[column].developer_data_index] = other.applications_[other_field.developer_data_index];
+      }
+      std::vector<double>& values = columns_[column];
+      values.resize(row_offset + other_values.size(), std::numeric_limits<double>::quiet_NaN());
+      std::copy(other_values.begin(), other_values.end(), values.begin() + row_offset);
+    }
+    ++registry_version_;
+  }
+
+  // fields legend: json key, units and application id
+  void ExportLegendToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer) const {
+    writer.StartArray();
+    for (size_t column = 0u; column < columns_.size(); ++column) {
+      if (columns_[column].empty()) {
+        continue;
+      }
+      const DeveloperField& field = fields_[column];
+      writer.StartObject();
+      writer.Key("key");
+      writer.String(field.name.data(), static_cast<rapidjson::SizeType>(field.name.size()));
+      writer.Key("units");
+      writer.String(field.units.data(), static_cast<rapidjson::SizeType>(field.units.size()));
+      const std::string& application = applications_[field.developer_data_index];
+      if (!application.empty()) {
+        writer.Key("application");
+        writer.String(application.data(), static_cast<rapidjson::SizeType>(application.size()));
+      }
+      writer.EndObject();
+    }
+    writer.EndArray();
+  }
+
+ private:
+  size_t FindField(const uint8_t developer_data_index, const uint8_t field_definition_number) const {
+    for (size_t index = 0u; index < fields_.size(); ++index) {
+      if (fields_[index].developer_data_index == developer_data_index && fields_[index].field_definition_number == field_definition_number) {
+        return index;
+      }
+    }
+    return fields_.size();
+  }
+
+  void Compile(const FIT_CONVERT_DEV_FIELD* dev_fields_ptr, const uint8_t dev_fields_count, const bool swap) {
+    plan_definition_.assign(dev_fields_ptr, dev_fields_ptr + dev_fields_count);
+    plan_version_ = registry_version_;
+    plan_swap_ = swap;
+    plan_.clear();
+    for (const FIT_CONVERT_DEV_FIELD& dev_field : plan_definition_) {
+      const size_t column = FindField(dev_field.developer_data_index, dev_field.num);
+      if (column == fields_.size()) {
+        // no field_description for it
+        continue;
+      }
+      const uint8_t type_index = fields_[column].base_type & FIT_BASE_TYPE_NUM_MASK;
+      if (type_index >= FIT_BASE_TYPES || fields_[column].base_type == FIT_BASE_TYPE_STRING) {
+        continue;
+      }
+      // arrays are reduced to the first element
+      const uint8_t type_size = fit_base_type_sizes[type_index];
+      if (dev_field.size < type_size) {
+        continue;
+      }
+      plan_.push_back({dev_field.offset, static_cast<uint16_t>(column), fields_[column].base_type, type_size});
+    }
+  }
+
+  bool ReadValue(const FIT_UINT8* data_ptr, const DeveloperFieldView& view, double& value) const {
+    std::array<FIT_UINT8, 8u> bytes;
+    std::memcpy(bytes.data(), data_ptr, view.size);
+    if (plan_swap_) {
+      std::reverse(bytes.begin(), bytes.begin() + view.size);
+    }
+    if (std::memcmp(bytes.data(), fit_base_type_invalids[view.base_type & FIT_BASE_TYPE_NUM_MASK], view.size) == 0) {
+      return false;
+    }
+    auto as = [&bytes]<typename T>(T) -> double {
+      T result;
+      std::memcpy(&result, bytes.data(), sizeof(T));
+      return static_cast<double>(result);
+    };
+    switch (view.base_type) {
+      case FIT_BASE_TYPE_SINT8:
+        value = as(FIT_SINT8{});
+        break;
+      case FIT_BASE_TYPE_SINT16:
+        value = as(FIT_SINT16{});
+        break;
+      case FIT_BASE_TYPE_UINT16:
+      case FIT_BASE_TYPE_UINT16Z:
+        value = as(FIT_UINT16{});
+        break;
+      case FIT_BASE_TYPE_SINT32:
+        value = as(FIT_SINT32{});
+        break;
+      case FIT_BASE_TYPE_UINT32:
+      case FIT_BASE_TYPE_UINT32Z:
+        value = as(FIT_UINT32{});
+        break;
+      case FIT_BASE_TYPE_FLOAT32:
+        value = as(FIT_FLOAT32{});
+        break;
+      case FIT_BASE_TYPE_FLOAT64:
+        value = as(FIT_FLOAT64{});
+        break;
+      case FIT_BASE_TYPE_SINT64:
+        value = as(FIT_SINT64{});
+        break;
+      case FIT_BASE_TYPE_UINT64:
+      case FIT_BASE_TYPE_UINT64Z:
+        value = as(FIT_UINT64{});
+        break;
+      default:
+        // enum, uint8, uint8z, byte
+        value = bytes[0];
+        break;
+    }
+    return std::isfinite(value);
+  }
+
+  std::vector<DeveloperField> fields_;
+  // values by field, NaN if the record has no value
+  std::vector<std::vector<double>> columns_;
+  // application id by developer_data_index
+  std::array<std::string, 256u> applications_;
+  uint32_t registry_version_{0u};
+  // compiled definition of the last message with developer data
+  std::vector<FIT_CONVERT_DEV_FIELD> plan_definition_;
+  std::vector<DeveloperFieldView> plan_;
+  uint32_t plan_version_{0u};
+  bool plan_swap_{false};
+};
+
 struct FitData {
   FitData() {
     memset(values, 0, sizeof(values));
@@ -361,9 +876,11 @@ struct FitData {
     ApplyValue(DataType::kTypeLatitude, fit_record_ptr->position_lat, collect_data_types);
     // FIT_SINT32 position_long = semicircles
     ApplyValue(DataType::kTypeLongitude, fit_record_ptr->position_long, collect_data_types);
+    // FIT_SINT16 grade = 100 * %
+    ApplyValue(DataType::kTypeGrade, fit_record_ptr->grade, collect_data_types);
   }
 
-  void ExportToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer, const bool imperial) {
+  void ExportToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer, const bool imperial, const DeveloperFields& developer_fields) const {
     writer.StartObject();
 
     if (ExportToJsonCheck(writer, DataType::kTypeTimeStamp)) {
@@ -426,10 +943,32 @@ struct FitData {
     }
     */
 
+    if (ExportToJsonCheck(writer, DataType::kTypeGrade)) {
+      // FIT_SINT16 grade = 100 * %
+      writer.Double(static_cast<double>(values[DataType::kTypeGrade]) / 100.0);
+    }
+
+    if (ExportToJsonCheck(writer, DataType::kTypeTimeDelta)) {
+      // milliseconds behind the reference at the same distance
+      writer.Double(static_cast<double>(values[DataType::kTypeTimeDelta]) / 1000.0);
+    }
+
+    if (ExportToJsonCheck(writer, DataType::kTypeSpeedDelta)) {
+      // mm/s faster than the reference at the same distance
+      writer.Double(static_cast<double>(values[DataType::kTypeSpeedDelta]) / (imperial ? 447.2136 : 277.77));
+    }
+
+    if (available_types & kDataTypeMasks[DataType::kTypeDeveloper]) {
+      developer_fields.ExportToJson(writer, row);
+    }
+
     writer.EndObject();
   }
 
-  void ExportToVtt(OutputBuffer& writer, const bool imperial) {
+  void ExportToVtt(OutputBuffer& writer,
+                   const bool imperial,
+                   const DeveloperFields& developer_fields,
+                   const CueTemplate& cue_template) const {
     const Time time_from(values[DataType::kTypeTimeStamp]);
     const Time time_to(values[DataType::kTypeTimeStampNext]);
     const FormatData& format = imperial ? kImperialFormat : kMetricFormat;
@@ -445,6 +984,13 @@ struct FitData {
     }
     writer.NewLine();
 
+    if (!cue_template.Empty()) {
+      ExportTemplateToVtt(writer, cue_template, developer_fields);
+      writer.NewLine();
+      writer.NewLine();
+      return;
+    }
+
     if (available_types & kDataTypeMasks[DataType::kTypeSpeed]) {
       // FIT_UINT32 enhanced_speed = 1000 * m/s = mm/s
       const size_t size = format_value_suffix(static_cast<double>(values[DataType::kTypeSpeed]) / (imperial ? 447.2136 : 277.77),
@@ -526,13 +1072,103 @@ struct FitData {
       writer.AppendString(formatting_buffer.data(), size);
     }
 
+    if (available_types & kDataTypeMasks[DataType::kTypeGrade]) {
+      // FIT_SINT16 grade = 100 * %
+      writer.Put(' ');
+      const size_t size = format_value_suffix(static_cast<double>(values[DataType::kTypeGrade]) / 100.0,
+                                              formatting_buffer.data(),
+                                              formatting_buffer.size(),
+                                              format[DataType::kTypeGrade].second,
+                                              format[DataType::kTypeGrade].first,
+                                              1);
+
+      writer.AppendString(formatting_buffer.data(), size);
+    }
+
+    if (available_types & kDataTypeMasks[DataType::kTypeTimeDelta]) {
+      // milliseconds behind the reference, shown with the sign
+      const double seconds = static_cast<double>(values[DataType::kTypeTimeDelta]) / 1000.0;
+      writer.Put(' ');
+      if (seconds > 0.0) {
+        writer.Put('+');
+      }
+      const size_t size = format_value_suffix(seconds,
+                                              formatting_buffer.data(),
+                                              formatting_buffer.size(),
+                                              format[DataType::kTypeTimeDelta].second,
+                                              format[DataType::kTypeTimeDelta].first,
+                                              1);
+
+      writer.AppendString(formatting_buffer.data(), size);
+    }
+
+    if (available_types & kDataTypeMasks[DataType::kTypeSpeedDelta]) {
+      const double speed = static_cast<double>(values[DataType::kTypeSpeedDelta]) / (imperial ? 447.2136 : 277.77);
+      writer.Put(' ');
+      if (speed > 0.0) {
+        writer.Put('+');
+      }
+      const size_t size = format_value_suffix(speed,
+                                              formatting_buffer.data(),
+                                              formatting_buffer.size(),
+                                              format[DataType::kTypeSpeedDelta].second,
+                                              format[DataType::kTypeSpeedDelta].first,
+                                              1);
+
+      writer.AppendString(formatting_buffer.data(), size);
+    }
+
+    if (available_types & kDataTypeMasks[DataType::kTypeDeveloper]) {
+      developer_fields.ExportToVtt(writer, row);
+    }
+
     writer.NewLine();
     writer.NewLine();
   }
 
+  // executes the compiled template: literal copies and formatting of the values in the output units
+  void ExportTemplateToVtt(OutputBuffer& writer, const CueTemplate& cue_template, const DeveloperFields& developer_fields) const {
+    std::array<char, 32u> formatting_buffer;
+    for (const CueTemplate::Instruction& instruction : cue_template.GetInstructions()) {
+      switch (instruction.kind) {
+        case CueTemplate::Kind::kLiteral: {
+          const std::string_view literal = cue_template.GetLiteral(instruction);
+          writer.AppendString(literal.data(), literal.size());
+          break;
+        }
+        case CueTemplate::Kind::kDeveloper:
+          if (available_types & kDataTypeMasks[DataType::kTypeDeveloper]) {
+            developer_fields.ExportToVtt(writer, row);
+          }
+          break;
+        case CueTemplate::Kind::kValue: {
+          if ((available_types & kDataTypeMasks[instruction.type]) == 0u) {
+            writer.AppendString(CueTemplate::kNoValue);
+            break;
+          }
+          const double value = static_cast<double>(values[instruction.type]) * instruction.scale + instruction.shift;
+          const size_t size = format_value_suffix(
+              value, formatting_buffer.data(), formatting_buffer.size(), instruction.width, std::string_view(), instruction.precision);
+          if (instruction.sign && value > 0.0) {
+            // the plus counts in the width as the minus does: it takes the last space of the padding
+            const size_t digits = std::string_view(formatting_buffer.data(), size).find_first_not_of(' ');
+            if (digits != 0u && digits != std::string_view::npos) {
+              formatting_buffer[digits - 1u] = '+';
+            } else {
+              writer.Put('+');
+            }
+          }
+          writer.AppendString(formatting_buffer.data(), size);
+          break;
+        }
+      }
+    }
+  }
+
   FitData operator-(const FitData right_value) noexcept {
     FitData diff_record;
     diff_record.available_types = available_types | right_value.available_types;
+    diff_record.row = row;
     for (uint32_t index = DataType::kTypeFirst; index < DataType::kTypeMax; ++index) {
       diff_record.values[index] = values[index] - right_value.values[index];
     }
@@ -542,6 +1178,7 @@ struct FitData {
   FitData operator+(const FitData right_value) noexcept {
     FitData summ_record;
     summ_record.available_types = available_types | right_value.available_types;
+    summ_record.row = row;
     for (uint32_t index = DataType::kTypeFirst; index < DataType::kTypeMax; ++index) {
       summ_record.values[index] = values[index] + right_value.values[index];
     }
@@ -551,6 +1188,7 @@ struct FitData {
   FitData operator/(const int64_t divider) noexcept {
     FitData divided_record;
     divided_record.available_types = available_types;
+    divided_record.row = row;
     for (uint32_t index = DataType::kTypeFirst; index < DataType::kTypeMax; ++index) {
       divided_record.values[index] = values[index] / divider;
     }
@@ -559,13 +1197,31 @@ struct FitData {
 
   void SetValue(const DataType type, const int64_t data) noexcept { values[type] = data; }
 
+  // set value from another source (hr messages etc.) and mark it as available
+  void MergeValue(const DataType type, const int64_t data) noexcept {
+    values[type] = data;
+    available_types |= kDataTypeMasks[type];
+  }
+
+  // drop the value and mark it as not available
+  void ResetValue(const DataType type) noexcept {
+    values[type] = 0;
+    available_types &= ~kDataTypeMasks[type];
+  }
+
   int64_t GetValue(const DataType type) const noexcept { return values[type]; }
 
   uint32_t GetTypes() const noexcept { return available_types; }
 
+  // index of the source record, developer fields are stored by it
+  void SetRow(const uint32_t index) noexcept { row = index; }
+
+  uint32_t GetRow() const noexcept { return row; }
+
  private:
   int64_t values[DataType::kTypeMax];
   uint32_t available_types{0u};
+  uint32_t row{0u};
 
  private:
   template <typename T>
@@ -577,7 +1233,7 @@ struct FitData {
     }
   }
 
-  bool ExportToJsonCheck(rapidjson::Writer<rapidjson::StringBuffer>& writer, DataType type) {
+  bool ExportToJsonCheck(rapidjson::Writer<rapidjson::StringBuffer>& writer, DataType type) const {
     if (available_types & kDataTypeMasks[type]) {
       writer.Key(rapidjson::StringRef(kDataTypes[type].second.data(), kDataTypes[type].second.size()));
       return true;
@@ -586,231 +1242,1962 @@ struct FitData {
   }
 };
 
-}  // namespace
-
-// names line delimited by commas
-uint32_t DataTypeNamesToMask(std::string_view names) {
-  std::vector<std::string_view> types;
-  size_t start = 0u;
-  size_t end = 0u;
-
-  while ((end = names.find(",", start)) != std::string::npos) {
-    const std::string_view tag(names.substr(start, end - start));
-    if (tag.size() > 0u) {
-      types.emplace_back(tag);
-    }
-    start = end + 1u;
-  }
-  const std::string_view last_tag(names.substr(start, names.size()));
-  if (last_tag.size() > 0u) {
-    types.emplace_back(last_tag);  // last token
-  }
-
-  uint32_t types_mask = 0u;
-  for (auto type : types) {
-    const auto dt = NameToDataType(type);
-    if (dt != DataType::kTypeMax) {
-      types_mask |= DataTypeToMask(dt);
-    }
-  }
+// beat-by-beat heart rate from FIT_MESG_NUM_HR, timestamp is milliseconds since UTC 00:00 Dec 31 1989
+struct HeartRateSample {
+  int64_t timestamp{0};
+  uint8_t bpm{0};
+};
 
-  return types_mask;
-}
+// R-R interval in milliseconds, timestamp of the beat that ends it
+struct HrvInterval {
+  int64_t timestamp{0};
+  uint16_t rr{0};
+};
 
-std::unique_ptr<FitResult> Convert(std::unique_ptr<DataSource> data_source_ptr,
-                                   const std::string_view output_type,
-                                   const int64_t offset,
-                                   const uint8_t smoothness,
-                                   const uint32_t collect_data_types,
-                                   const bool imperial) {
-  auto result = std::make_unique<FitResult>();
-  result->first = ParseResult::kError;
+// three_d_sensor_calibration: calibrated = rotation * ((raw - level_shift - offset) * factor / divisor)
+struct SensorCalibration {
+  float scale{1.0f};
+  float level_shift{0.0f};
+  std::array<float, 3> offset{0.0f, 0.0f, 0.0f};
+  // row major, identity by default
+  std::array<float, 9> rotation{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+};
 
-  const bool json_output = (output_type == kOutputJsonTag);
-  const bool vtt_output = (output_type == kOutputVttTag);
+// accelerometer (g) or gyroscope (deg/s) samples as dense columns at the native rate
+struct SensorStream {
+  std::vector<int64_t> timestamps;
+  // raw counts during decoding, calibrated by CalibrateSensorStream
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  // calibration in effect starting from the sample index
+  std::vector<std::pair<size_t, SensorCalibration>> calibrations;
+};
 
-  // used_data_types - mask of values DataType values: 0x01 << DataType
-  uint32_t used_data_types{0u};
-  uint32_t file_items{0u};
+// everything collected from .fit during the decode pass, exported afterwards
+struct FitActivity {
+  std::vector<FitData> records;
+  std::vector<HeartRateSample> heart_rate;
+  // R-R intervals from FIT_MESG_NUM_HRV
+  std::vector<HrvInterval> hrv;
+  SensorStream accelerometer;
+  SensorStream gyroscope;
+  DeveloperFields developer_fields;
   uint32_t non_msg_counter{0u};
-  int64_t first_fit_timestamp{0};
-  int64_t first_video_timestamp{0};
-
-  const size_t data_source_size = data_source_ptr->GetSize();
-  FIT_CONVERT_RETURN fit_status = FIT_CONVERT_CONTINUE;
-  FitConvert_Init(FIT_TRUE);
-  Buffer data_buffer(4096u * 16u);
+  // number of chained files
+  uint32_t files{0u};
+  // stopped recording between stitched inputs, fit timestamps in milliseconds
+  std::vector<std::pair<int64_t, int64_t>> gaps;
+  // timer stop and the next timer start from FIT_MESG_NUM_EVENT, fit timestamps in milliseconds
+  std::vector<std::pair<int64_t, int64_t>> pauses;
+};
 
-  OutputBuffer write_buffer;
-  // start json creation
-  rapidjson::Writer<rapidjson::StringBuffer> writer(write_buffer);
-  write_buffer.Reserve((data_source_size == 0u ? (2048u * 1024u) : (data_source_size + (data_source_size >> 2u))));
-  if (json_output) {
-    writer.SetMaxDecimalPlaces(2);
-    writer.StartObject();
-    // records
-    writer.Key("records");
-    writer.StartArray();
-  } else if (vtt_output) {
-    write_buffer.AppendString(kVttHeaderTag);
+constexpr size_t kHrEventTimestamps = FIT_HR_MESG_FILTERED_BPM_COUNT;
+constexpr uint32_t kHrEventTimestamp12Mask = 0xFFFu;
+// event timestamps are 1/1024 s, fractional timestamp is 1/32768 s
+constexpr int64_t kHrEventTimestampScale = 1024;
+constexpr int64_t kHrFractionalTimestampScale = 32768;
+// beats averaged into the record when it has no heart rate of its own
+constexpr int64_t kHrMergeWindowMs = 1000;
+// last beat is used if there were no beats within merge window
+constexpr int64_t kHrMergeHoldMs = 5000;
+
+static_assert(FIT_HR_MESG_EVENT_TIMESTAMP_12_COUNT * 8 == kHrEventTimestamps * 12, "event_timestamp_12 should hold all timestamps");
+
+// unpack 8 12-bit values (12 bytes, little-endian bit order) as two 48-bit words, no per-value branching
+void UnpackTimestamps12(const FIT_BYTE* packed_ptr, std::array<uint16_t, kHrEventTimestamps>& unpacked) {
+  static_assert(FIT_ARCH_ENDIAN == FIT_ARCH_ENDIAN_LITTLE, "UnpackTimestamps12 expects little-endian host");
+  constexpr size_t kHalf = kHrEventTimestamps / 2;
+  uint64_t low{0u};
+  uint64_t high{0u};
+  std::memcpy(&low, packed_ptr, 6u);
+  std::memcpy(&high, packed_ptr + 6u, 6u);
+  for (size_t index = 0u; index < kHalf; ++index) {
+    unpacked[index] = static_cast<uint16_t>((low >> (12u * index)) & kHrEventTimestamp12Mask);
+    unpacked[index + kHalf] = static_cast<uint16_t>((high >> (12u * index)) & kHrEventTimestamp12Mask);
   }
+}
 
-  // make exporter
-  auto MakeExporter = [](auto& write_buffer, auto& writer, auto& vtt_output, auto& json_output, auto& imperial) {
-    return [&](auto&& x) noexcept -> void {
-      if (json_output) {
-        x->ExportToJson(writer, imperial);
-      } else if (vtt_output) {
-        x->ExportToVtt(write_buffer, imperial);
+// expands FIT_HR_MESG arrays into samples, event timestamps are accumulated across messages
+class HeartRateDecoder {
+ public:
+  void Apply(const FIT_HR_MESG* hr_ptr, std::vector<HeartRateSample>& samples) {
+    std::array<uint32_t, kHrEventTimestamps> event_timestamps;
+    if (hr_ptr->event_timestamp[0] != FIT_UINT32_INVALID) {
+      for (size_t index = 0u; index < kHrEventTimestamps; ++index) {
+        event_timestamps[index] = hr_ptr->event_timestamp[index];
+        if (event_timestamps[index] != FIT_UINT32_INVALID) {
+          last_event_timestamp_ = event_timestamps[index];
+        }
       }
-    };
-  };
-  auto Export = MakeExporter(write_buffer, writer, vtt_output, json_output, imperial);
-
-
-  FitData new_fit_data;
-  FitData previous_fit_data;
-  FitData* new_fit_data_ptr = &new_fit_data;
-  FitData* previous_fot_data_ptr = nullptr;
-
-  while ((DataSource::Status::kError != data_source_ptr->ReadData(data_buffer)) && (fit_status == FIT_CONVERT_CONTINUE) &&
-         data_buffer.GetDataSize() > 0u) {
-    while (fit_status = FitConvert_Read(data_buffer.GetDataPtr(), static_cast<FIT_UINT32>(data_buffer.GetDataSize())),
-           fit_status == FIT_CONVERT_MESSAGE_AVAILABLE) {
-      if (FitConvert_GetMessageNumber() != FIT_MESG_NUM_RECORD) {
-        non_msg_counter++;
-        continue;
+    } else {
+      std::array<uint16_t, kHrEventTimestamps> unpacked;
+      UnpackTimestamps12(hr_ptr->event_timestamp_12, unpacked);
+      for (size_t index = 0u; index < kHrEventTimestamps; ++index) {
+        last_event_timestamp_ += (unpacked[index] - last_event_timestamp_) & kHrEventTimestamp12Mask;
+        event_timestamps[index] = last_event_timestamp_;
       }
+    }
 
-      const FIT_UINT8* fit_message_ptr = FitConvert_GetMessageData();
-      const FIT_RECORD_MESG* fit_record_ptr = reinterpret_cast<const FIT_RECORD_MESG*>(fit_message_ptr);
-
-      // convert timestamp to milliseconds
-      const int64_t type_msec = static_cast<int64_t>(fit_record_ptr->timestamp) * 1000;
-      // fit timestamp should not be 0, because it's milliseconds since UTC 00:00 Dec 31 1989
-      if (0 == first_fit_timestamp) {
-        first_fit_timestamp = type_msec;
-        if (offset > 0) {
-          first_fit_timestamp += offset;
-        } else if (offset < 0) {
-          first_video_timestamp = std::abs(offset);
-          if (vtt_output) {
-            // write message that .fit data is not yet ready
-            const Time start(0);
-            const Time end(first_video_timestamp);
-            std::array<char, 32> formatting_buffer;
-            const size_t size_start = format_timestamp(formatting_buffer.data(), formatting_buffer.size(), start);
-            write_buffer.AppendString(formatting_buffer.data(), size_start);
-            write_buffer.AppendString(kVttTimeSeparator);
-            const size_t size_end = format_timestamp(formatting_buffer.data(), formatting_buffer.size(), end);
-            write_buffer.AppendString(formatting_buffer.data(), size_end);
-            write_buffer.AppendString(kVttOffsetMessage);
-            write_buffer.AppendString(kVttMessage);
-          }
-        }
+    if (hr_ptr->timestamp != FIT_DATE_TIME_INVALID) {
+      anchor_timestamp_ = static_cast<int64_t>(hr_ptr->timestamp) * 1000;
+      if (hr_ptr->fractional_timestamp != FIT_UINT16_INVALID) {
+        anchor_timestamp_ += static_cast<int64_t>(hr_ptr->fractional_timestamp) * 1000 / kHrFractionalTimestampScale;
       }
+      anchor_event_timestamp_ = event_timestamps[0];
+    }
+    if (anchor_timestamp_ == 0) {
+      // no time reference yet
+      return;
+    }
 
-      if (offset > 0) {
-        // positive offset, 'offset' second of the data from .fit file will displayed at the first second of the video
-        if (type_msec < first_fit_timestamp) {
-          continue;
-        }
+    for (size_t index = 0u; index < kHrEventTimestamps; ++index) {
+      if (hr_ptr->filtered_bpm[index] == FIT_UINT8_INVALID || event_timestamps[index] == FIT_UINT32_INVALID) {
+        break;
       }
+      const int64_t event_delta = static_cast<int64_t>(event_timestamps[index]) - static_cast<int64_t>(anchor_event_timestamp_);
+      samples.push_back({anchor_timestamp_ + event_delta * 1000 / kHrEventTimestampScale, hr_ptr->filtered_bpm[index]});
+    }
+  }
 
-      // fill data from .fit
-      new_fit_data_ptr->ApplyData(fit_record_ptr, collect_data_types);
+ private:
+  int64_t anchor_timestamp_{0};
+  uint32_t anchor_event_timestamp_{0u};
+  uint32_t last_event_timestamp_{0u};
+};
+
+// fill heart rate of the records that have none from beat-by-beat samples
+void MergeHeartRate(std::vector<FitData>& records, std::vector<HeartRateSample>& samples) {
+  if (samples.empty()) {
+    return;
+  }
+  auto by_time = [](const HeartRateSample& left, const HeartRateSample& right) { return left.timestamp < right.timestamp; };
+  if (!std::is_sorted(samples.begin(), samples.end(), by_time)) {
+    std::stable_sort(samples.begin(), samples.end(), by_time);
+  }
+
+  for (FitData& record : records) {
+    if (record.GetTypes() & kDataTypeMasks[DataType::kTypeHeartRate]) {
+      continue;
+    }
+    const int64_t timestamp = record.GetValue(DataType::kTypeTimeStamp);
+    const auto window_end = std::upper_bound(
+        samples.begin(), samples.end(), timestamp, [](const int64_t value, const HeartRateSample& sample) { return value < sample.timestamp; });
+    if (window_end == samples.begin()) {
+      continue;
+    }
+    uint32_t bpm_sum{0u};
+    uint32_t beats{0u};
+    for (auto it = window_end; it != samples.begin() && (timestamp - std::prev(it)->timestamp) < kHrMergeWindowMs; --it) {
+      bpm_sum += std::prev(it)->bpm;
+      ++beats;
+    }
+    if (beats > 0u) {
+      record.MergeValue(DataType::kTypeHeartRate, bpm_sum / beats);
+    } else if ((timestamp - std::prev(window_end)->timestamp) <= kHrMergeHoldMs) {
+      record.MergeValue(DataType::kTypeHeartRate, std::prev(window_end)->bpm);
+    }
+  }
+}
+
+constexpr size_t kSensorSamples = FIT_ACCELEROMETER_DATA_MESG_SAMPLE_TIME_OFFSET_COUNT;
+constexpr float kSensorRotationScale = 65535.0f;
+
+static_assert(FIT_GYROSCOPE_DATA_MESG_SAMPLE_TIME_OFFSET_COUNT == kSensorSamples, "sensor messages should have the same size");
+
+SensorCalibration ToSensorCalibration(const FIT_THREE_D_SENSOR_CALIBRATION_MESG* calibration_ptr) {
+  SensorCalibration calibration;
+  if (calibration_ptr->calibration_factor != FIT_UINT32_INVALID && calibration_ptr->calibration_divisor != FIT_UINT32_INVALID &&
+      calibration_ptr->calibration_divisor != 0u) {
+    calibration.scale = static_cast<float>(static_cast<double>(calibration_ptr->calibration_factor) / calibration_ptr->calibration_divisor);
+  }
+  if (calibration_ptr->level_shift != FIT_UINT32_INVALID) {
+    calibration.level_shift = static_cast<float>(calibration_ptr->level_shift);
+  }
+  for (size_t axis = 0u; axis < calibration.offset.size(); ++axis) {
+    if (calibration_ptr->offset_cal[axis] != FIT_SINT32_INVALID) {
+      calibration.offset[axis] = static_cast<float>(calibration_ptr->offset_cal[axis]);
+    }
+  }
+  if (calibration_ptr->orientation_matrix[0] != FIT_SINT32_INVALID) {
+    for (size_t index = 0u; index < calibration.rotation.size(); ++index) {
+      calibration.rotation[index] = static_cast<float>(calibration_ptr->orientation_matrix[index]) / kSensorRotationScale;
+    }
+  }
+  return calibration;
+}
+
+// accelerometer_data and gyroscope_data have the same layout but different names of the axes
+template <typename T>
+void AppendSensorSamples(const T* sensor_ptr, const FIT_UINT16* x_ptr, const FIT_UINT16* y_ptr, const FIT_UINT16* z_ptr, SensorStream& stream) {
+  if (sensor_ptr->timestamp == FIT_DATE_TIME_INVALID) {
+    return;
+  }
+  int64_t timestamp = static_cast<int64_t>(sensor_ptr->timestamp) * 1000;
+  if (sensor_ptr->timestamp_ms != FIT_UINT16_INVALID) {
+    timestamp += sensor_ptr->timestamp_ms;
+  }
+  size_t count = 0u;
+  while (count < kSensorSamples && sensor_ptr->sample_time_offset[count] != FIT_UINT16_INVALID && x_ptr[count] != FIT_UINT16_INVALID) {
+    ++count;
+  }
+  for (size_t index = 0u; index < count; ++index) {
+    stream.timestamps.push_back(timestamp + sensor_ptr->sample_time_offset[index]);
+  }
+  stream.x.insert(stream.x.end(), x_ptr, x_ptr + count);
+  stream.y.insert(stream.y.end(), y_ptr, y_ptr + count);
+  stream.z.insert(stream.z.end(), z_ptr, z_ptr + count);
+}
+
+// calibrate samples in place, no branches inside the loop so it's vectorized by the compiler
+void CalibrateSensorSamples(float* x_ptr, float* y_ptr, float* z_ptr, const size_t count, const SensorCalibration& calibration) {
+  const float bias_x = calibration.level_shift + calibration.offset[0];
+  const float bias_y = calibration.level_shift + calibration.offset[1];
+  const float bias_z = calibration.level_shift + calibration.offset[2];
+  const float scale = calibration.scale;
+  const std::array<float, 9>& r = calibration.rotation;
+  for (size_t index = 0u; index < count; ++index) {
+    const float cx = (x_ptr[index] - bias_x) * scale;
+    const float cy = (y_ptr[index] - bias_y) * scale;
+    const float cz = (z_ptr[index] - bias_z) * scale;
+    x_ptr[index] = r[0] * cx + r[1] * cy + r[2] * cz;
+    y_ptr[index] = r[3] * cx + r[4] * cy + r[5] * cz;
+    z_ptr[index] = r[6] * cx + r[7] * cy + r[8] * cz;
+  }
+}
+
+// samples before the first calibration message stay in raw counts
+void CalibrateSensorStream(SensorStream& stream) {
+  for (size_t index = 0u; index < stream.calibrations.size(); ++index) {
+    const size_t begin = stream.calibrations[index].first;
+    const size_t end = (index + 1u < stream.calibrations.size()) ? stream.calibrations[index + 1u].first : stream.x.size();
+    if (end > begin) {
+      CalibrateSensorSamples(
+          stream.x.data() + begin, stream.y.data() + begin, stream.z.data() + begin, end - begin, stream.calibrations[index].second);
+    }
+  }
+}
+
+// [{"from":ms,"to":ms}] in video time, nothing is written for no intervals
+void ExportIntervalsToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer,
+                           const std::string_view key,
+                           const std::vector<std::pair<int64_t, int64_t>>& intervals) {
+  if (intervals.empty()) {
+    return;
+  }
+  writer.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()));
+  writer.StartArray();
+  for (const auto& [from_ms, to_ms] : intervals) {
+    writer.StartObject();
+    writer.Key("from");
+    writer.Int64(from_ms);
+    writer.Key("to");
+    writer.Int64(to_ms);
+    writer.EndObject();
+  }
+  writer.EndArray();
+}
+
+void ExportSensorToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer,
+                        const DataType type,
+                        const SensorStream& stream,
+                        const int64_t first_fit_timestamp,
+                        const int64_t first_video_timestamp) {
+  writer.Key(rapidjson::StringRef(kDataTypes[type].first.data(), kDataTypes[type].first.size()));
+  writer.StartObject();
+  // samples before the first exported record are skipped, same as records
+  const size_t first = static_cast<size_t>(
+      std::find_if(stream.timestamps.begin(), stream.timestamps.end(), [&](const int64_t value) { return value >= first_fit_timestamp; }) -
+      stream.timestamps.begin());
+  writer.Key(rapidjson::StringRef(kDataTypes[DataType::kTypeTimeStamp].second.data(), kDataTypes[DataType::kTypeTimeStamp].second.size()));
+  writer.StartArray();
+  for (size_t index = first; index < stream.timestamps.size(); ++index) {
+    writer.Int64(stream.timestamps[index] - first_fit_timestamp + first_video_timestamp);
+  }
+  writer.EndArray();
+  const std::array<std::pair<const char*, const std::vector<float>*>, 3> axes = {{{"x", &stream.x}, {"y", &stream.y}, {"z", &stream.z}}};
+  for (const auto& [name, values] : axes) {
+    writer.Key(name);
+    writer.StartArray();
+    for (size_t index = first; index < values->size(); ++index) {
+      writer.Double((*values)[index]);
+    }
+    writer.EndArray();
+  }
+  writer.EndObject();
+}
+
+// sensor samples of chained files can overlap, keep them ordered by time
+void SortSensorStream(SensorStream& stream) {
+  if (std::is_sorted(stream.timestamps.begin(), stream.timestamps.end())) {
+    return;
+  }
+  std::vector<size_t> order(stream.timestamps.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(
+      order.begin(), order.end(), [&stream](const size_t left, const size_t right) { return stream.timestamps[left] < stream.timestamps[right]; });
+  auto reorder = [&order](auto& values) {
+    std::remove_reference_t<decltype(values)> sorted;
+    sorted.reserve(values.size());
+    for (const size_t index : order) {
+      sorted.push_back(values[index]);
+    }
+    values = std::move(sorted);
+  };
+  reorder(stream.timestamps);
+  reorder(stream.x);
+  reorder(stream.y);
+  reorder(stream.z);
+}
+
+void AppendSensorStream(SensorStream& stream, SensorStream& file_stream) {
+  stream.timestamps.insert(stream.timestamps.end(), file_stream.timestamps.begin(), file_stream.timestamps.end());
+  stream.x.insert(stream.x.end(), file_stream.x.begin(), file_stream.x.end());
+  stream.y.insert(stream.y.end(), file_stream.y.begin(), file_stream.y.end());
+  stream.z.insert(stream.z.end(), file_stream.z.begin(), file_stream.z.end());
+}
+
+// chained files are decoded separately and appended in the stream order
+void AppendActivity(FitActivity& activity, FitActivity& file_activity) {
+  // calibration messages apply only to the file they are in
+  CalibrateSensorStream(file_activity.accelerometer);
+  CalibrateSensorStream(file_activity.gyroscope);
+  file_activity.accelerometer.calibrations.clear();
+  file_activity.gyroscope.calibrations.clear();
+
+  // stitched inputs can have several chained files already
+  const uint32_t files = std::max(1u, file_activity.files);
+  if (activity.files == 0u) {
+    activity = std::move(file_activity);
+    activity.files = files;
+    return;
+  }
+
+  const uint32_t row_offset = static_cast<uint32_t>(activity.records.size());
+  for (FitData& record : file_activity.records) {
+    record.SetRow(record.GetRow() + row_offset);
+  }
+  activity.records.insert(activity.records.end(), file_activity.records.begin(), file_activity.records.end());
+  activity.developer_fields.Append(file_activity.developer_fields, row_offset);
+  activity.heart_rate.insert(activity.heart_rate.end(), file_activity.heart_rate.begin(), file_activity.heart_rate.end());
+  activity.hrv.insert(activity.hrv.end(), file_activity.hrv.begin(), file_activity.hrv.end());
+  activity.pauses.insert(activity.pauses.end(), file_activity.pauses.begin(), file_activity.pauses.end());
+  AppendSensorStream(activity.accelerometer, file_activity.accelerometer);
+  AppendSensorStream(activity.gyroscope, file_activity.gyroscope);
+  activity.non_msg_counter += file_activity.non_msg_counter;
+  activity.files += files;
+}
+
+// merge chained files into one monotonic timeline
+void SortActivity(FitActivity& activity) {
+  if (activity.files < 2u) {
+    return;
+  }
+  auto by_time = [](const FitData& left, const FitData& right) {
+    return left.GetValue(DataType::kTypeTimeStamp) < right.GetValue(DataType::kTypeTimeStamp);
+  };
+  if (!std::is_sorted(activity.records.begin(), activity.records.end(), by_time)) {
+    std::stable_sort(activity.records.begin(), activity.records.end(), by_time);
+  }
+  SortSensorStream(activity.accelerometer);
+  SortSensorStream(activity.gyroscope);
+  auto hrv_by_time = [](const HrvInterval& left, const HrvInterval& right) { return left.timestamp < right.timestamp; };
+  if (!std::is_sorted(activity.hrv.begin(), activity.hrv.end(), hrv_by_time)) {
+    std::stable_sort(activity.hrv.begin(), activity.hrv.end(), hrv_by_time);
+  }
+  std::sort(activity.pauses.begin(), activity.pauses.end());
+}
+
+// decodes .fit messages into FitActivity, has its own converter state so decoders can run in parallel
+class FitDecoder {
+ public:
+  explicit FitDecoder(const uint32_t collect_data_types)
+      : collect_data_types_(collect_data_types),
+        collect_heart_rate_((collect_data_types & kDataTypeMasks[DataType::kTypeHeartRate]) != 0u),
+        collect_accelerometer_((collect_data_types & kDataTypeMasks[DataType::kTypeAccelerometer]) != 0u),
+        collect_gyroscope_((collect_data_types & kDataTypeMasks[DataType::kTypeGyroscope]) != 0u),
+        collect_developer_((collect_data_types & kDataTypeMasks[DataType::kTypeDeveloper]) != 0u) {
+    FitConvert_Init(&state_, FIT_TRUE);
+  }
+
+  FitDecoder(const FitDecoder&) = delete;
+  FitDecoder& operator=(const FitDecoder&) = delete;
+
+  FIT_CONVERT_RETURN Read(const void* data_ptr, const size_t size) {
+    FIT_CONVERT_RETURN status;
+    while (status = FitConvert_Read(&state_, data_ptr, static_cast<FIT_UINT32>(size)), status == FIT_CONVERT_MESSAGE_AVAILABLE) {
+      ApplyMessage();
+    }
+    return status;
+  }
+
+  // after FIT_CONVERT_END_OF_FILE: returns the decoded file, the next chained one is decoded from the same data
+  FitActivity NextFile() {
+    FitConvert_InitNext(&state_, FIT_TRUE);
+    heart_rate_decoder_ = HeartRateDecoder();
+    hrv_time_ms_ = kNoTime;
+    // the timer stopped at the end of the file is not a pause
+    pause_from_ms_ = kNoPause;
+    return std::exchange(activity_, FitActivity());
+  }
+
+  // some bytes of the current file were decoded
+  bool IsFileStarted() const noexcept { return state_.decode_state != FIT_CONVERT_DECODE_FILE_HDR || state_.mesg_offset != 0u; }
+
+  FitActivity& GetActivity() noexcept { return activity_; }
+
+ private:
+  void ApplyMessage() {
+    const FIT_UINT8* fit_message_ptr = FitConvert_GetMessageData(&state_);
+    switch (FitConvert_GetMessageNumber(&state_)) {
+      case FIT_MESG_NUM_RECORD: {
+        const FIT_RECORD_MESG* fit_record_ptr = reinterpret_cast<const FIT_RECORD_MESG*>(fit_message_ptr);
+        FitData& record = activity_.records.emplace_back(fit_record_ptr, collect_data_types_);
+        // keep timestamp even if it was not requested, it's used for timeline
+        record.SetValue(DataType::kTypeTimeStamp, static_cast<int64_t>(fit_record_ptr->timestamp) * 1000);
+        if (collect_developer_) {
+          FIT_UINT8 dev_fields_count{0u};
+          const FIT_CONVERT_DEV_FIELD* dev_fields_ptr = FitConvert_GetDevFields(&state_, &dev_fields_count);
+          if (dev_fields_count > 0u) {
+            const uint32_t row = static_cast<uint32_t>(activity_.records.size() - 1u);
+            record.SetRow(row);
+            if (activity_.developer_fields.ApplyData(
+                    row, dev_fields_ptr, dev_fields_count, FitConvert_GetDevData(&state_), FitConvert_GetMessageArch(&state_))) {
+              record.MergeValue(DataType::kTypeDeveloper, 0);
+            }
+          }
+        }
+        break;
+      }
+      case FIT_MESG_NUM_EVENT:
+        ApplyTimerEvent(reinterpret_cast<const FIT_EVENT_MESG*>(fit_message_ptr));
+        break;
+      case FIT_MESG_NUM_DEVELOPER_DATA_ID:
+        activity_.developer_fields.ApplyDeveloper(reinterpret_cast<const FIT_DEVELOPER_DATA_ID_MESG*>(fit_message_ptr));
+        break;
+      case FIT_MESG_NUM_FIELD_DESCRIPTION:
+        activity_.developer_fields.ApplyDescription(reinterpret_cast<const FIT_FIELD_DESCRIPTION_MESG*>(fit_message_ptr));
+        break;
+      case FIT_MESG_NUM_HR:
+        if (collect_heart_rate_) {
+          heart_rate_decoder_.Apply(reinterpret_cast<const FIT_HR_MESG*>(fit_message_ptr), activity_.heart_rate);
+        }
+        break;
+      case FIT_MESG_NUM_HRV:
+        if (collect_heart_rate_) {
+          ApplyHrv(reinterpret_cast<const FIT_HRV_MESG*>(fit_message_ptr));
+        }
+        break;
+      case FIT_MESG_NUM_ACCELEROMETER_DATA:
+        if (collect_accelerometer_) {
+          const FIT_ACCELEROMETER_DATA_MESG* fit_accel_ptr = reinterpret_cast<const FIT_ACCELEROMETER_DATA_MESG*>(fit_message_ptr);
+          AppendSensorSamples(fit_accel_ptr, fit_accel_ptr->accel_x, fit_accel_ptr->accel_y, fit_accel_ptr->accel_z, activity_.accelerometer);
+        }
+        break;
+      case FIT_MESG_NUM_GYROSCOPE_DATA:
+        if (collect_gyroscope_) {
+          const FIT_GYROSCOPE_DATA_MESG* fit_gyro_ptr = reinterpret_cast<const FIT_GYROSCOPE_DATA_MESG*>(fit_message_ptr);
+          AppendSensorSamples(fit_gyro_ptr, fit_gyro_ptr->gyro_x, fit_gyro_ptr->gyro_y, fit_gyro_ptr->gyro_z, activity_.gyroscope);
+        }
+        break;
+      case FIT_MESG_NUM_THREE_D_SENSOR_CALIBRATION: {
+        const FIT_THREE_D_SENSOR_CALIBRATION_MESG* fit_calibration_ptr =
+            reinterpret_cast<const FIT_THREE_D_SENSOR_CALIBRATION_MESG*>(fit_message_ptr);
+        if (fit_calibration_ptr->sensor_type == FIT_SENSOR_TYPE_ACCELEROMETER && collect_accelerometer_) {
+          activity_.accelerometer.calibrations.emplace_back(activity_.accelerometer.x.size(), ToSensorCalibration(fit_calibration_ptr));
+        } else if (fit_calibration_ptr->sensor_type == FIT_SENSOR_TYPE_GYROSCOPE && collect_gyroscope_) {
+          activity_.gyroscope.calibrations.emplace_back(activity_.gyroscope.x.size(), ToSensorCalibration(fit_calibration_ptr));
+        }
+        break;
+      }
+      default:
+        activity_.non_msg_counter++;
+        break;
+    }
+  }
+
+  // timer stop opens a pause, the next timer start closes it
+  void ApplyTimerEvent(const FIT_EVENT_MESG* fit_event_ptr) {
+    if (fit_event_ptr->event != FIT_EVENT_TIMER || fit_event_ptr->timestamp == FIT_DATE_TIME_INVALID) {
+      return;
+    }
+    const int64_t timestamp = static_cast<int64_t>(fit_event_ptr->timestamp) * 1000;
+    switch (fit_event_ptr->event_type) {
+      case FIT_EVENT_TYPE_STOP:
+      case FIT_EVENT_TYPE_STOP_ALL:
+      case FIT_EVENT_TYPE_STOP_DISABLE:
+      case FIT_EVENT_TYPE_STOP_DISABLE_ALL:
+        if (pause_from_ms_ == kNoPause) {
+          pause_from_ms_ = timestamp;
+        }
+        break;
+      case FIT_EVENT_TYPE_START:
+        if (pause_from_ms_ != kNoPause && timestamp > pause_from_ms_) {
+          activity_.pauses.emplace_back(pause_from_ms_, timestamp);
+        }
+        pause_from_ms_ = kNoPause;
+        break;
+      default:
+        break;
+    }
+  }
+
+  // hrv messages have no timestamp: the beats are the running sum of the intervals from the last timestamp of the file, the sum
+  // starts again from it when they are apart by more than the hold window (beats were not recorded)
+  void ApplyHrv(const FIT_HRV_MESG* fit_hrv_ptr) {
+    if (state_.timestamp == 0u) {
+      // nothing to place the intervals before the first timestamp
+      return;
+    }
+    const int64_t anchor_ms = static_cast<int64_t>(state_.timestamp) * 1000;
+    if (hrv_time_ms_ == kNoTime || std::abs(hrv_time_ms_ - anchor_ms) > kHrMergeHoldMs) {
+      hrv_time_ms_ = anchor_ms;
+    }
+    for (const FIT_UINT16 rr : fit_hrv_ptr->time) {
+      if (rr != FIT_UINT16_INVALID) {
+        hrv_time_ms_ += rr;
+        activity_.hrv.push_back({hrv_time_ms_, rr});
+      }
+    }
+  }
+
+  static constexpr int64_t kNoPause = -1;
+  static constexpr int64_t kNoTime = -1;
+
+  // zeroed: a local message type without a definition has size 0 and is skipped
+  FIT_CONVERT_STATE state_{};
+  FitActivity activity_;
+  HeartRateDecoder heart_rate_decoder_;
+  int64_t pause_from_ms_{kNoPause};
+  // fit timestamp of the last hrv beat in milliseconds
+  int64_t hrv_time_ms_{kNoTime};
+  const uint32_t collect_data_types_;
+  const bool collect_heart_rate_;
+  const bool collect_accelerometer_;
+  const bool collect_gyroscope_;
+  const bool collect_developer_;
+};
+
+constexpr size_t kFitHeaderMinSize = 12u;
+constexpr size_t kFitCrcSize = 2u;
+// pause between stitched inputs to mark it as a stopped recording
+constexpr int64_t kGapMinMs = 2000;
+// exported time frame of the last record before a gap or the end
+constexpr int64_t kLastItemMs = 1000;
+// merged inputs: value of an input is not used when it is older than this
+constexpr int64_t kMergeStaleMs = 3000;
+// merged inputs: clock skew search range in seconds and the minimal correlated overlap
+constexpr int64_t kSkewMaxS = 300;
+constexpr size_t kSkewMinOverlap = 30u;
+constexpr double kSkewMinCorrelation = 0.5;
+// merged inputs: the clock skew is not estimated for a longer overlap, the clocks are wrong
+constexpr int64_t kSkewMaxOverlapS = 48 * 3600;
+// records keep the invalid timestamp of the profile, they are not placed in time
+constexpr int64_t kInvalidTimestampMs = static_cast<int64_t>(FIT_DATE_TIME_INVALID) * 1000;
+
+// offsets and sizes of the chained .fit files, taken from the file headers without decoding
+std::vector<std::pair<size_t, size_t>> FindChainedFiles(const uint8_t* data_ptr, const size_t size) {
+  std::vector<std::pair<size_t, size_t>> files;
+  size_t position = 0u;
+  while (size - position >= kFitHeaderMinSize) {
+    const uint8_t* header_ptr = data_ptr + position;
+    const size_t header_size = header_ptr[0];
+    if (header_size < kFitHeaderMinSize || std::memcmp(header_ptr + 8u, ".FIT", 4u) != 0) {
+      break;
+    }
+    const size_t data_size = static_cast<size_t>(header_ptr[4]) | (static_cast<size_t>(header_ptr[5]) << 8u) |
+                             (static_cast<size_t>(header_ptr[6]) << 16u) | (static_cast<size_t>(header_ptr[7]) << 24u);
+    const size_t file_size = header_size + data_size + kFitCrcSize;
+    if (file_size > size - position) {
+      break;
+    }
+    files.emplace_back(position, file_size);
+    position += file_size;
+  }
+  return files;
+}
+
+// decode chained files of the contiguous data in parallel, results are in the stream order
+std::vector<std::pair<FIT_CONVERT_RETURN, FitActivity>> DecodeChainedFiles(const uint8_t* data_ptr,
+                                                                           const std::vector<std::pair<size_t, size_t>>& files,
+                                                                           const uint32_t collect_data_types) {
+  std::vector<std::pair<FIT_CONVERT_RETURN, FitActivity>> results(files.size());
+  std::atomic<size_t> next_file{0u};
+  auto worker = [&]() {
+    for (size_t index = next_file++; index < files.size(); index = next_file++) {
+      auto decoder_ptr = std::make_unique<FitDecoder>(collect_data_types);
+      decoder_ptr->GetActivity().records.reserve(files[index].second / 32u);
+      results[index].first = decoder_ptr->Read(data_ptr + files[index].first, files[index].second);
+      results[index].second = std::move(decoder_ptr->GetActivity());
+    }
+  };
+  const size_t threads = std::min<size_t>(files.size(), std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> workers;
+  for (size_t thread = 1u; thread < threads; ++thread) {
+    workers.push_back(std::async(std::launch::async, worker));
+  }
+  worker();
+  for (auto& future : workers) {
+    future.get();
+  }
+  return results;
+}
+
+// decode one input, several .fit files can be chained in it
+std::pair<FIT_CONVERT_RETURN, FitActivity> DecodeSource(DataSource& data_source, const uint32_t collect_data_types) {
+  const size_t data_source_size = data_source.GetSize();
+  FIT_CONVERT_RETURN fit_status = FIT_CONVERT_CONTINUE;
+  FitActivity activity;
+  // several .fit files can be chained in one stream, each one is decoded and appended
+  const uint8_t* contiguous_data_ptr = data_source.GetContiguousData();
+  const std::vector<std::pair<size_t, size_t>> chained_files =
+      (contiguous_data_ptr != nullptr) ? FindChainedFiles(contiguous_data_ptr, data_source_size) : std::vector<std::pair<size_t, size_t>>();
+  bool file_incomplete{false};
+  if (chained_files.size() > 1u) {
+    auto decoded_files = DecodeChainedFiles(contiguous_data_ptr, chained_files, collect_data_types);
+    for (auto& [file_status, file_activity] : decoded_files) {
+      fit_status = file_status;
+      if (fit_status != FIT_CONVERT_END_OF_FILE) {
+        break;
+      }
+      AppendActivity(activity, file_activity);
+    }
+    file_incomplete = (chained_files.back().first + chained_files.back().second) < data_source_size;
+  } else {
+    auto decoder_ptr = std::make_unique<FitDecoder>(collect_data_types);
+    decoder_ptr->GetActivity().records.reserve(data_source_size / 32u);
+    Buffer data_buffer(4096u * 16u);
+    while ((DataSource::Status::kError != data_source.ReadData(data_buffer)) && (fit_status == FIT_CONVERT_CONTINUE) &&
+           data_buffer.GetDataSize() > 0u) {
+      while (fit_status = decoder_ptr->Read(data_buffer.GetDataPtr(), data_buffer.GetDataSize()), fit_status == FIT_CONVERT_END_OF_FILE) {
+        FitActivity file_activity = decoder_ptr->NextFile();
+        AppendActivity(activity, file_activity);
+      }
+    }
+    file_incomplete = decoder_ptr->IsFileStarted();
+  }
+
+  if (activity.files > 0u) {
+    // the first files are still usable if the chained one after them is broken
+    if ((fit_status != FIT_CONVERT_CONTINUE && fit_status != FIT_CONVERT_END_OF_FILE) || file_incomplete) {
+      SPDLOG_WARN("data after {} chained .fit file(s) can not be decoded and is skipped", activity.files);
+    }
+    fit_status = FIT_CONVERT_END_OF_FILE;
+  }
+  return {fit_status, std::move(activity)};
+}
+
+// decode every input, the activities are in the inputs order
+FIT_CONVERT_RETURN DecodeSources(std::vector<std::unique_ptr<DataSource>>& data_sources,
+                                 const uint32_t collect_data_types,
+                                 std::vector<FitActivity>& activities) {
+  std::vector<std::pair<FIT_CONVERT_RETURN, FitActivity>> decoded;
+  if (data_sources.size() == 1u) {
+    decoded.push_back(DecodeSource(*data_sources.front(), collect_data_types));
+  } else {
+    // every input has its own decoder state, so they are decoded concurrently
+    std::vector<std::future<std::pair<FIT_CONVERT_RETURN, FitActivity>>> futures;
+    futures.reserve(data_sources.size());
+    for (auto& data_source_ptr : data_sources) {
+      futures.push_back(std::async(std::launch::async, DecodeSource, std::ref(*data_source_ptr), collect_data_types));
+    }
+    for (auto& future : futures) {
+      decoded.push_back(future.get());
+    }
+  }
+
+  for (size_t index = 0u; index < decoded.size(); ++index) {
+    if (decoded[index].first != FIT_CONVERT_END_OF_FILE) {
+      if (decoded.size() > 1u) {
+        SPDLOG_ERROR("input {} can not be decoded", index + 1u);
+      }
+      return decoded[index].first;
+    }
+  }
+  activities.clear();
+  for (auto& [file_status, file_activity] : decoded) {
+    activities.push_back(std::move(file_activity));
+  }
+  return FIT_CONVERT_END_OF_FILE;
+}
+
+// inputs are separate recordings of one activity, ordered by the start time and joined into one timeline
+FIT_CONVERT_RETURN StitchSources(std::vector<std::unique_ptr<DataSource>>& data_sources,
+                                 const uint32_t collect_data_types,
+                                 FitActivity& activity) {
+  std::vector<FitActivity> decoded;
+  const FIT_CONVERT_RETURN fit_status = DecodeSources(data_sources, collect_data_types, decoded);
+  if (fit_status != FIT_CONVERT_END_OF_FILE) {
+    return fit_status;
+  }
+
+  // inputs without records go last, they have nothing to place on the timeline
+  auto start_of = [](const FitActivity& file_activity) {
+    return file_activity.records.empty() ? std::numeric_limits<int64_t>::max()
+                                         : file_activity.records.front().GetValue(DataType::kTypeTimeStamp);
+  };
+  std::stable_sort(decoded.begin(), decoded.end(), [&start_of](const FitActivity& left, const FitActivity& right) {
+    return start_of(left) < start_of(right);
+  });
+
+  int64_t last_timestamp{0};
+  for (FitActivity& file_activity : decoded) {
+    int64_t first_timestamp{0};
+    int64_t file_last_timestamp{0};
+    if (!file_activity.records.empty()) {
+      // chained files of the input are not sorted yet
+      const auto [min_it, max_it] = std::minmax_element(
+          file_activity.records.begin(), file_activity.records.end(), [](const FitData& left, const FitData& right) {
+            return left.GetValue(DataType::kTypeTimeStamp) < right.GetValue(DataType::kTypeTimeStamp);
+          });
+      first_timestamp = min_it->GetValue(DataType::kTypeTimeStamp);
+      file_last_timestamp = max_it->GetValue(DataType::kTypeTimeStamp);
+    }
+    AppendActivity(activity, file_activity);
+    if (file_last_timestamp == 0) {
+      continue;
+    }
+    if (last_timestamp != 0 && (first_timestamp - last_timestamp) > kGapMinMs) {
+      activity.gaps.emplace_back(last_timestamp, first_timestamp);
+    }
+    last_timestamp = std::max(last_timestamp, file_last_timestamp);
+  }
+  return FIT_CONVERT_END_OF_FILE;
+}
+
+// order of the inputs by field, the value of a merged record comes from the first input that has it
+using MergePriorities = std::array<std::vector<size_t>, DataType::kTypeMax>;
+
+// "power=2,cadence=2" - the input (counted from 1) is preferred for the field, the rest follow in the inputs order
+bool ParseMergePriorities(const std::string_view spec, const size_t inputs, MergePriorities& priorities) {
+  std::vector<size_t> inputs_order(inputs);
+  std::iota(inputs_order.begin(), inputs_order.end(), 0u);
+  priorities.fill(inputs_order);
+
+  size_t start = 0u;
+  while (start < spec.size()) {
+    const size_t end = std::min(spec.find(',', start), spec.size());
+    const std::string_view item(spec.substr(start, end - start));
+    start = end + 1u;
+    if (item.empty()) {
+      continue;
+    }
+    const size_t separator = item.find('=');
+    if (separator == std::string_view::npos) {
+      return false;
+    }
+    const DataType type = NameToDataType(item.substr(0u, separator));
+    const std::string_view number(item.substr(separator + 1u));
+    size_t input{0u};
+    const auto [number_end_ptr, ec] = std::from_chars(number.data(), number.data() + number.size(), input);
+    if (type == DataType::kTypeMax || type == DataType::kTypeTimeStamp || type == DataType::kTypeTimeStampNext || ec != std::errc{} ||
+        number_end_ptr != number.data() + number.size() || input == 0u || input > inputs) {
+      return false;
+    }
+    auto prefer = [input](std::vector<size_t>& order) {
+      order.erase(std::find(order.begin(), order.end(), input - 1u));
+      order.insert(order.begin(), input - 1u);
+    };
+    prefer(priorities[type]);
+    // position is taken from one device only
+    if (type == DataType::kTypeLatitude) {
+      prefer(priorities[DataType::kTypeLongitude]);
+    } else if (type == DataType::kTypeLongitude) {
+      prefer(priorities[DataType::kTypeLatitude]);
+    }
+  }
+  return true;
+}
+
+// first and last second of the records with a valid timestamp, false if there are none
+bool RecordsSpan(const std::vector<FitData>& records, int64_t& first_second, int64_t& last_second) {
+  bool found{false};
+  for (const FitData& record : records) {
+    const int64_t timestamp = record.GetValue(DataType::kTypeTimeStamp);
+    if (timestamp == kInvalidTimestampMs) {
+      continue;
+    }
+    first_second = found ? std::min(first_second, timestamp / 1000) : timestamp / 1000;
+    last_second = found ? std::max(last_second, timestamp / 1000) : timestamp / 1000;
+    found = true;
+  }
+  return found;
+}
+
+// 1 Hz values of the channel from first_second to last_second, NaN for seconds without a value
+std::vector<double> ChannelSeries(const std::vector<FitData>& records,
+                                  const DataType type,
+                                  const int64_t first_second,
+                                  const int64_t last_second) {
+  std::vector<double> series(static_cast<size_t>(last_second - first_second + 1), std::numeric_limits<double>::quiet_NaN());
+  bool has_values{false};
+  for (const FitData& record : records) {
+    const int64_t timestamp = record.GetValue(DataType::kTypeTimeStamp);
+    if (timestamp == kInvalidTimestampMs || timestamp / 1000 < first_second || timestamp / 1000 > last_second ||
+        (record.GetTypes() & kDataTypeMasks[type]) == 0u) {
+      continue;
+    }
+    series[static_cast<size_t>(timestamp / 1000 - first_second)] = static_cast<double>(record.GetValue(type));
+    has_values = true;
+  }
+  if (!has_values) {
+    series.clear();
+  }
+  return series;
+}
+
+// clock difference of the devices in milliseconds, the lag with the best correlation of speed or heart rate
+int64_t EstimateClockSkew(const std::vector<FitData>& reference, const std::vector<FitData>& records) {
+  // both series are the overlap of the inputs and the search range around it
+  int64_t reference_first{0};
+  int64_t reference_last{0};
+  int64_t first{0};
+  int64_t last{0};
+  if (!RecordsSpan(reference, reference_first, reference_last) || !RecordsSpan(records, first, last)) {
+    return 0;
+  }
+  const int64_t window_first = std::max(reference_first, first) - kSkewMaxS;
+  const int64_t window_last = std::min(reference_last, last) + kSkewMaxS;
+  if (window_last < window_first) {
+    return 0;
+  }
+  if (window_last - window_first > kSkewMaxOverlapS) {
+    SPDLOG_WARN("inputs overlap for {} s, the clock skew is not estimated", window_last - window_first);
+    return 0;
+  }
+  for (const DataType type : {DataType::kTypeSpeed, DataType::kTypeHeartRate}) {
+    const std::vector<double> reference_series = ChannelSeries(reference, type, window_first, window_last);
+    const std::vector<double> series = ChannelSeries(records, type, window_first, window_last);
+    if (reference_series.empty() || series.empty()) {
+      continue;
+    }
+    double best_correlation{kSkewMinCorrelation};
+    int64_t best_lag{0};
+    bool found{false};
+    // lags closer to zero win ties
+    for (int64_t step = 0; step <= 2 * kSkewMaxS; ++step) {
+      const int64_t lag = (step % 2 == 0) ? (step / 2) : -((step + 1) / 2);
+      // reference second t is matched with second t + lag of the input
+      const int64_t shift = lag;
+      const int64_t from = std::max<int64_t>(0, -shift);
+      const int64_t to = std::min<int64_t>(static_cast<int64_t>(reference_series.size()), static_cast<int64_t>(series.size()) - shift);
+      double sum_x{0.0}, sum_y{0.0}, sum_xx{0.0}, sum_yy{0.0}, sum_xy{0.0};
+      size_t count{0u};
+      for (int64_t index = from; index < to; ++index) {
+        const double x = reference_series[static_cast<size_t>(index)];
+        const double y = series[static_cast<size_t>(index + shift)];
+        if (std::isnan(x) || std::isnan(y)) {
+          continue;
+        }
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_yy += y * y;
+        sum_xy += x * y;
+        ++count;
+      }
+      if (count < kSkewMinOverlap) {
+        continue;
+      }
+      const double n = static_cast<double>(count);
+      const double variance = (n * sum_xx - sum_x * sum_x) * (n * sum_yy - sum_y * sum_y);
+      if (variance <= 0.0) {
+        continue;
+      }
+      const double correlation = (n * sum_xy - sum_x * sum_y) / std::sqrt(variance);
+      if (correlation > best_correlation) {
+        best_correlation = correlation;
+        best_lag = lag;
+        found = true;
+      }
+    }
+    if (found) {
+      return -best_lag * 1000;
+    }
+  }
+  return 0;
+}
+
+void ShiftActivity(FitActivity& activity, const int64_t shift_ms) {
+  for (FitData& record : activity.records) {
+    record.SetValue(DataType::kTypeTimeStamp, record.GetValue(DataType::kTypeTimeStamp) + shift_ms);
+    record.SetValue(DataType::kTypeTimeStampNext, record.GetValue(DataType::kTypeTimeStampNext) + shift_ms);
+  }
+  for (HeartRateSample& sample : activity.heart_rate) {
+    sample.timestamp += shift_ms;
+  }
+  for (HrvInterval& interval : activity.hrv) {
+    interval.timestamp += shift_ms;
+  }
+  for (int64_t& timestamp : activity.accelerometer.timestamps) {
+    timestamp += shift_ms;
+  }
+  for (int64_t& timestamp : activity.gyroscope.timestamps) {
+    timestamp += shift_ms;
+  }
+  for (auto& [from_ms, to_ms] : activity.pauses) {
+    from_ms += shift_ms;
+    to_ms += shift_ms;
+  }
+}
+
+// k-way merge of the sorted inputs by timestamp, one merged record per timestamp with the latest values of every input
+std::vector<FitData> MergeRecords(const std::vector<FitActivity>& activities,
+                                  const std::vector<uint32_t>& row_offsets,
+                                  const MergePriorities& priorities) {
+  using Cursor = std::pair<int64_t, size_t>;  // timestamp, input
+  std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> heap;
+  std::vector<size_t> positions(activities.size(), 0u);
+  std::vector<const FitData*> latest(activities.size(), nullptr);
+  size_t total{0u};
+  for (size_t input = 0u; input < activities.size(); ++input) {
+    if (!activities[input].records.empty()) {
+      heap.emplace(activities[input].records.front().GetValue(DataType::kTypeTimeStamp), input);
+    }
+    total += activities[input].records.size();
+  }
+
+  std::vector<FitData> merged;
+  merged.reserve(total);
+  while (!heap.empty()) {
+    const int64_t timestamp = heap.top().first;
+    const size_t first_input = heap.top().second;
+    while (!heap.empty() && heap.top().first == timestamp) {
+      const size_t input = heap.top().second;
+      heap.pop();
+      const std::vector<FitData>& records = activities[input].records;
+      latest[input] = &records[positions[input]];
+      if (++positions[input] < records.size()) {
+        heap.emplace(records[positions[input]].GetValue(DataType::kTypeTimeStamp), input);
+      }
+    }
+
+    FitData record = *latest[first_input];
+    for (uint32_t type = DataType::kTypeFirst; type < DataType::kTypeMax; ++type) {
+      if (type == DataType::kTypeTimeStamp || type == DataType::kTypeTimeStampNext || type == DataType::kTypeAccelerometer ||
+          type == DataType::kTypeGyroscope) {
+        continue;
+      }
+      record.ResetValue(static_cast<DataType>(type));
+      for (const size_t input : priorities[type]) {
+        const FitData* source_ptr = latest[input];
+        if (source_ptr == nullptr || (source_ptr->GetTypes() & kDataTypeMasks[type]) == 0u ||
+            (timestamp - source_ptr->GetValue(DataType::kTypeTimeStamp)) > kMergeStaleMs) {
+          continue;
+        }
+        record.MergeValue(static_cast<DataType>(type), source_ptr->GetValue(static_cast<DataType>(type)));
+        if (type == DataType::kTypeDeveloper) {
+          record.SetRow(source_ptr->GetRow() + row_offsets[input]);
+        }
+        break;
+      }
+    }
+    merged.push_back(record);
+  }
+  return merged;
+}
+
+// inputs are recorded at the same time by several devices, they are aligned and merged into one record stream
+FIT_CONVERT_RETURN MergeSources(std::vector<std::unique_ptr<DataSource>>& data_sources,
+                                const uint32_t collect_data_types,
+                                const MergePriorities& priorities,
+                                FitActivity& activity) {
+  std::vector<FitActivity> decoded;
+  const FIT_CONVERT_RETURN fit_status = DecodeSources(data_sources, collect_data_types, decoded);
+  if (fit_status != FIT_CONVERT_END_OF_FILE) {
+    return fit_status;
+  }
+
+  std::vector<uint32_t> row_offsets;
+  uint32_t rows{0u};
+  for (size_t input = 0u; input < decoded.size(); ++input) {
+    SortActivity(decoded[input]);
+    // the first input is the clock reference
+    if (input > 0u) {
+      const int64_t skew_ms = EstimateClockSkew(decoded.front().records, decoded[input].records);
+      if (skew_ms != 0) {
+        SPDLOG_INFO("input {} clock is corrected by {} ms", input + 1u, skew_ms);
+        ShiftActivity(decoded[input], skew_ms);
+      }
+    }
+    row_offsets.push_back(rows);
+    activity.developer_fields.Append(decoded[input].developer_fields, rows);
+    rows += static_cast<uint32_t>(decoded[input].records.size());
+    activity.files += std::max(1u, decoded[input].files);
+    activity.non_msg_counter += decoded[input].non_msg_counter;
+  }
+  activity.records = MergeRecords(decoded, row_offsets, priorities);
+  // clocks of the other inputs are aligned to the first one, so its timer is used
+  activity.pauses = std::move(decoded.front().pauses);
+
+  // streams can not be combined, they are taken from the preferred input that has them
+  auto preferred = [&decoded, &priorities](const DataType type, auto has_stream) -> FitActivity* {
+    for (const size_t input : priorities[type]) {
+      if (has_stream(decoded[input])) {
+        return &decoded[input];
+      }
+    }
+    return nullptr;
+  };
+  if (FitActivity* source_ptr = preferred(DataType::kTypeHeartRate, [](const FitActivity& input) { return !input.heart_rate.empty(); })) {
+    activity.heart_rate = std::move(source_ptr->heart_rate);
+  }
+  if (FitActivity* source_ptr = preferred(DataType::kTypeHeartRate, [](const FitActivity& input) { return !input.hrv.empty(); })) {
+    activity.hrv = std::move(source_ptr->hrv);
+  }
+  if (FitActivity* source_ptr =
+          preferred(DataType::kTypeAccelerometer, [](const FitActivity& input) { return !input.accelerometer.timestamps.empty(); })) {
+    activity.accelerometer = std::move(source_ptr->accelerometer);
+  }
+  if (FitActivity* source_ptr =
+          preferred(DataType::kTypeGyroscope, [](const FitActivity& input) { return !input.gyroscope.timestamps.empty(); })) {
+    activity.gyroscope = std::move(source_ptr->gyroscope);
+  }
+  return FIT_CONVERT_END_OF_FILE;
+}
+
+constexpr double kEarthRadiusM = 6371008.8;
+constexpr double kSemicirclesToRadians = std::numbers::pi / 2147483648.0;
+// speed from positions: half of the time window around the record
+constexpr int64_t kDeriveSpeedWindowMs = 2000;
+// grade: half of the distance window around the record and the minimal distance of the window, cm
+constexpr int64_t kDeriveGradeWindowCm = 1000;
+constexpr int64_t kDeriveGradeMinCm = 1000;
+
+// great circle length of the segment to every point from the previous one in meters, the first one is 0
+void HaversineDistances(const double* latitude_ptr, const double* longitude_ptr, const size_t count, double* distances_ptr) {
+  if (count == 0u) {
+    return;
+  }
+  distances_ptr[0] = 0.0;
+  // no dependency between iterations, the compiler vectorizes it
+  for (size_t index = 1u; index < count; ++index) {
+    const double sin_latitude = std::sin((latitude_ptr[index] - latitude_ptr[index - 1u]) * 0.5);
+    const double sin_longitude = std::sin((longitude_ptr[index] - longitude_ptr[index - 1u]) * 0.5);
+    const double a = sin_latitude * sin_latitude + std::cos(latitude_ptr[index - 1u]) * std::cos(latitude_ptr[index]) * sin_longitude * sin_longitude;
+    distances_ptr[index] = 2.0 * kEarthRadiusM * std::asin(std::sqrt(std::min(1.0, a)));
+  }
+}
+
+// altitude of the records with position from the elevation model, the device altitude stays where there is no tile
+size_t CorrectAltitude(std::vector<FitData>& records, DemTiles& dem) {
+  const uint32_t position_mask = kDataTypeMasks[DataType::kTypeLatitude] | kDataTypeMasks[DataType::kTypeLongitude];
+  constexpr double kSemicirclesToDegrees = 180.0 / 2147483648.0;
+  std::vector<size_t> rows;
+  std::vector<double> latitudes;
+  std::vector<double> longitudes;
+  for (size_t index = 0u; index < records.size(); ++index) {
+    if ((records[index].GetTypes() & position_mask) == position_mask) {
+      rows.push_back(index);
+      latitudes.push_back(static_cast<double>(records[index].GetValue(DataType::kTypeLatitude)) * kSemicirclesToDegrees);
+      longitudes.push_back(static_cast<double>(records[index].GetValue(DataType::kTypeLongitude)) * kSemicirclesToDegrees);
+    }
+  }
+  std::vector<double> elevations(rows.size());
+  dem.Elevations(latitudes.data(), longitudes.data(), rows.size(), elevations.data());
+  size_t corrected{0u};
+  for (size_t position = 0u; position < rows.size(); ++position) {
+    if (std::isnan(elevations[position])) {
+      continue;
+    }
+    // altitude = 5 * m + 500
+    records[rows[position]].MergeValue(DataType::kTypeAltitude, std::llround((elevations[position] + 500.0) * 5.0));
+    ++corrected;
+  }
+  return corrected;
+}
+
+// fill distance and speed from positions and grade from altitude and distance, only for the fields no record has
+void DeriveActivity(std::vector<FitData>& records, const uint32_t derive_data_types) {
+  auto has_any = [&records](const DataType type) {
+    return std::any_of(records.begin(), records.end(), [type](const FitData& record) { return (record.GetTypes() & kDataTypeMasks[type]) != 0u; });
+  };
+  const bool derive_distance = (derive_data_types & kDataTypeMasks[DataType::kTypeDistance]) && !has_any(DataType::kTypeDistance);
+  const bool derive_speed = (derive_data_types & kDataTypeMasks[DataType::kTypeSpeed]) && !has_any(DataType::kTypeSpeed);
+  const bool derive_grade = (derive_data_types & kDataTypeMasks[DataType::kTypeGrade]) && !has_any(DataType::kTypeGrade);
+
+  if (derive_distance || derive_speed) {
+    // columns of the records with position
+    const uint32_t position_mask = kDataTypeMasks[DataType::kTypeLatitude] | kDataTypeMasks[DataType::kTypeLongitude];
+    std::vector<size_t> rows;
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    for (size_t index = 0u; index < records.size(); ++index) {
+      if ((records[index].GetTypes() & position_mask) == position_mask) {
+        rows.push_back(index);
+        latitudes.push_back(static_cast<double>(records[index].GetValue(DataType::kTypeLatitude)) * kSemicirclesToRadians);
+        longitudes.push_back(static_cast<double>(records[index].GetValue(DataType::kTypeLongitude)) * kSemicirclesToRadians);
+      }
+    }
+    std::vector<double> distances(rows.size());
+    HaversineDistances(latitudes.data(), longitudes.data(), rows.size(), distances.data());
+    std::partial_sum(distances.begin(), distances.end(), distances.begin());
+
+    if (derive_distance && !rows.empty()) {
+      // records without position keep the distance of the previous one
+      size_t position = 0u;
+      for (size_t index = rows.front(); index < records.size(); ++index) {
+        while (position + 1u < rows.size() && rows[position + 1u] <= index) {
+          ++position;
+        }
+        records[index].MergeValue(DataType::kTypeDistance, std::llround(distances[position] * 100.0));
+      }
+    }
+
+    if (derive_speed) {
+      size_t from = 0u;
+      size_t to = 0u;
+      for (size_t position = 0u; position < rows.size(); ++position) {
+        const int64_t timestamp = records[rows[position]].GetValue(DataType::kTypeTimeStamp);
+        while (records[rows[from]].GetValue(DataType::kTypeTimeStamp) < timestamp - kDeriveSpeedWindowMs) {
+          ++from;
+        }
+        while (to + 1u < rows.size() && records[rows[to + 1u]].GetValue(DataType::kTypeTimeStamp) <= timestamp + kDeriveSpeedWindowMs) {
+          ++to;
+        }
+        const int64_t duration_ms = records[rows[to]].GetValue(DataType::kTypeTimeStamp) - records[rows[from]].GetValue(DataType::kTypeTimeStamp);
+        if (duration_ms > 0) {
+          // m/ms to mm/s
+          records[rows[position]].MergeValue(DataType::kTypeSpeed,
+                                             std::llround((distances[to] - distances[from]) * 1000000.0 / static_cast<double>(duration_ms)));
+        }
+      }
+    }
+  }
+
+  if (derive_grade) {
+    const uint32_t grade_mask = kDataTypeMasks[DataType::kTypeDistance] | kDataTypeMasks[DataType::kTypeAltitude];
+    std::vector<size_t> rows;
+    for (size_t index = 0u; index < records.size(); ++index) {
+      if ((records[index].GetTypes() & grade_mask) == grade_mask) {
+        rows.push_back(index);
+      }
+    }
+    size_t from = 0u;
+    size_t to = 0u;
+    for (size_t position = 0u; position < rows.size(); ++position) {
+      const int64_t distance = records[rows[position]].GetValue(DataType::kTypeDistance);
+      while (records[rows[from]].GetValue(DataType::kTypeDistance) < distance - kDeriveGradeWindowCm) {
+        ++from;
+      }
+      while (to + 1u < rows.size() && records[rows[to + 1u]].GetValue(DataType::kTypeDistance) <= distance + kDeriveGradeWindowCm) {
+        ++to;
+      }
+      const FitData& first = records[rows[from]];
+      const FitData& last = records[rows[std::max(to, position)]];
+      const int64_t window_cm = last.GetValue(DataType::kTypeDistance) - first.GetValue(DataType::kTypeDistance);
+      if (window_cm >= kDeriveGradeMinCm) {
+        // altitude = 5 * m + 500, grade = 100 * %
+        const double climb_cm = static_cast<double>(last.GetValue(DataType::kTypeAltitude) - first.GetValue(DataType::kTypeAltitude)) * 20.0;
+        records[rows[position]].MergeValue(DataType::kTypeGrade, std::llround(climb_cm * 10000.0 / static_cast<double>(window_cm)));
+      }
+    }
+  }
+}
+
+// reference ride for the comparison: elapsed time and speed by distance, distances are strictly increasing
+class DistanceIndex {
+ public:
+  explicit DistanceIndex(const std::vector<FitData>& records) {
+    const uint32_t distance_mask = kDataTypeMasks[DataType::kTypeDistance];
+    const auto first = std::find_if(
+        records.begin(), records.end(), [distance_mask](const FitData& record) { return (record.GetTypes() & distance_mask) != 0u; });
+    if (first == records.end()) {
+      return;
+    }
+    const int64_t start_ms = records.front().GetValue(DataType::kTypeTimeStamp);
+    for (auto it = first; it != records.end(); ++it) {
+      if ((it->GetTypes() & distance_mask) == 0u) {
+        continue;
+      }
+      // standing still or gps noise, the first time at the distance is kept
+      const int64_t distance = it->GetValue(DataType::kTypeDistance);
+      if (!distances_.empty() && distance <= distances_.back()) {
+        continue;
+      }
+      distances_.push_back(distance);
+      elapsed_.push_back(it->GetValue(DataType::kTypeTimeStamp) - start_ms);
+      speeds_.push_back((it->GetTypes() & kDataTypeMasks[DataType::kTypeSpeed]) ? it->GetValue(DataType::kTypeSpeed) : kNoSpeed);
+    }
+  }
+
+  size_t Size() const noexcept { return distances_.size(); }
+
+  // interpolated elapsed time and speed (kNoSpeed if unknown) at the distance, false out of the reference range
+  bool Lookup(const int64_t distance, int64_t& elapsed_ms, int64_t& speed) const {
+    if (distances_.size() < 2u || distance < distances_.front() || distance > distances_.back()) {
+      return false;
+    }
+    const size_t upper = static_cast<size_t>(std::lower_bound(distances_.begin(), distances_.end(), distance) - distances_.begin());
+    if (distances_[upper] == distance) {
+      elapsed_ms = elapsed_[upper];
+      speed = speeds_[upper];
+      return true;
+    }
+    const size_t lower = upper - 1u;
+    const double fraction = static_cast<double>(distance - distances_[lower]) / static_cast<double>(distances_[upper] - distances_[lower]);
+    elapsed_ms = elapsed_[lower] + std::llround(fraction * static_cast<double>(elapsed_[upper] - elapsed_[lower]));
+    speed = (speeds_[lower] == kNoSpeed || speeds_[upper] == kNoSpeed)
+                ? kNoSpeed
+                : speeds_[lower] + std::llround(fraction * static_cast<double>(speeds_[upper] - speeds_[lower]));
+    return true;
+  }
+
+  static constexpr int64_t kNoSpeed = -1;
+
+ private:
+  // cm
+  std::vector<int64_t> distances_;
+  // milliseconds from the start of the reference
+  std::vector<int64_t> elapsed_;
+  // mm/s
+  std::vector<int64_t> speeds_;
+};
+
+// gap to the reference ride at the same distance: time delta (positive is behind) and speed delta
+void CompareActivity(std::vector<FitData>& records, const DistanceIndex& reference, const uint32_t collect_data_types) {
+  if (records.empty() || reference.Size() < 2u) {
+    return;
+  }
+  const bool collect_time = (collect_data_types & kDataTypeMasks[DataType::kTypeTimeDelta]) != 0u;
+  const bool collect_speed = (collect_data_types & kDataTypeMasks[DataType::kTypeSpeedDelta]) != 0u;
+  const int64_t start_ms = records.front().GetValue(DataType::kTypeTimeStamp);
+  for (FitData& record : records) {
+    if ((record.GetTypes() & kDataTypeMasks[DataType::kTypeDistance]) == 0u) {
+      continue;
+    }
+    int64_t reference_elapsed_ms{0};
+    int64_t reference_speed{0};
+    if (!reference.Lookup(record.GetValue(DataType::kTypeDistance), reference_elapsed_ms, reference_speed)) {
+      continue;
+    }
+    if (collect_time) {
+      record.MergeValue(DataType::kTypeTimeDelta, (record.GetValue(DataType::kTypeTimeStamp) - start_ms) - reference_elapsed_ms);
+    }
+    if (collect_speed && reference_speed != DistanceIndex::kNoSpeed && (record.GetTypes() & kDataTypeMasks[DataType::kTypeSpeed])) {
+      record.MergeValue(DataType::kTypeSpeedDelta, record.GetValue(DataType::kTypeSpeed) - reference_speed);
+    }
+  }
+}
+
+// --where filter: comparisons of record values in the output units joined by && || ! and parentheses, "power > 400 && grade > 8"
+enum class FilterOp : uint8_t {
+  kLess,
+  kLessEqual,
+  kGreater,
+  kGreaterEqual,
+  kEqual,
+  kNotEqual,
+  kAnd,
+  kOr,
+  kNot,
+};
+
+// one step of the postfix program, comparisons push a mask, logical operations combine the masks on the stack
+struct FilterInstruction {
+  FilterOp op{FilterOp::kGreater};
+  DataType type{DataType::kTypeMax};
+  // in the stored units of the value
+  double threshold{0.0};
+};
+
+struct FilterProgram {
+  std::vector<FilterInstruction> instructions;
+  // datatypes used by the comparisons
+  uint32_t data_types{0u};
+  size_t max_stack{0u};
+};
+
+class FilterCompiler {
+ public:
+  FilterCompiler(const std::string_view expression, const bool imperial) : expression_(expression), imperial_(imperial) {}
+
+  bool Compile(FilterProgram& program) {
+    if (!ParseOr() || (SkipSpaces(), position_ != expression_.size())) {
+      return false;
+    }
+    program.instructions = std::move(instructions_);
+    program.data_types = data_types_;
+    program.max_stack = max_stack_;
+    return true;
+  }
+
+ private:
+  void SkipSpaces() {
+    while (position_ < expression_.size() && std::isspace(static_cast<unsigned char>(expression_[position_]))) {
+      ++position_;
+    }
+  }
+
+  bool Accept(const std::string_view token) {
+    SkipSpaces();
+    if (expression_.substr(position_, token.size()) != token) {
+      return false;
+    }
+    position_ += token.size();
+    return true;
+  }
+
+  void Emit(const FilterInstruction& instruction) {
+    instructions_.push_back(instruction);
+    if (instruction.op == FilterOp::kAnd || instruction.op == FilterOp::kOr) {
+      --stack_;
+    } else if (instruction.op != FilterOp::kNot) {
+      max_stack_ = std::max(max_stack_, ++stack_);
+    }
+  }
+
+  bool ParseOr() {
+    if (!ParseAnd()) {
+      return false;
+    }
+    while (Accept("||")) {
+      if (!ParseAnd()) {
+        return false;
+      }
+      Emit({FilterOp::kOr});
+    }
+    return true;
+  }
+
+  bool ParseAnd() {
+    if (!ParseUnary()) {
+      return false;
+    }
+    while (Accept("&&")) {
+      if (!ParseUnary()) {
+        return false;
+      }
+      Emit({FilterOp::kAnd});
+    }
+    return true;
+  }
+
+  bool ParseUnary() {
+    if (Accept("!")) {
+      if (!ParseUnary()) {
+        return false;
+      }
+      Emit({FilterOp::kNot});
+      return true;
+    }
+    if (Accept("(")) {
+      return ParseOr() && Accept(")");
+    }
+    return ParseComparison();
+  }
+
+  bool ParseComparison() {
+    SkipSpaces();
+    const size_t name_start = position_;
+    while (position_ < expression_.size() && std::isalpha(static_cast<unsigned char>(expression_[position_]))) {
+      ++position_;
+    }
+    const DataType type = FieldNameToDataType(expression_.substr(name_start, position_ - name_start));
+    double scale{1.0};
+    double shift{0.0};
+    if (type == DataType::kTypeMax || !OutputUnits(type, imperial_, scale, shift)) {
+      return false;
+    }
+
+    // two char operators first
+    constexpr std::array<std::pair<std::string_view, FilterOp>, 6> kOperators = {{{"<=", FilterOp::kLessEqual},
+                                                                                  {">=", FilterOp::kGreaterEqual},
+                                                                                  {"==", FilterOp::kEqual},
+                                                                                  {"!=", FilterOp::kNotEqual},
+                                                                                  {"<", FilterOp::kLess},
+                                                                                  {">", FilterOp::kGreater}}};
+    const auto found = std::find_if(kOperators.begin(), kOperators.end(), [this](const auto& entry) { return Accept(entry.first); });
+    if (found == kOperators.end()) {
+      return false;
+    }
+
+    SkipSpaces();
+    double value{0.0};
+    const auto [end_ptr, error] = std::from_chars(expression_.data() + position_, expression_.data() + expression_.size(), value);
+    if (error != std::errc()) {
+      return false;
+    }
+    position_ = static_cast<size_t>(end_ptr - expression_.data());
+    Emit({found->second, type, value * scale + shift});
+    data_types_ |= kDataTypeMasks[type];
+    return true;
+  }
+
+  const std::string_view expression_;
+  const bool imperial_;
+  size_t position_{0u};
+  std::vector<FilterInstruction> instructions_;
+  uint32_t data_types_{0u};
+  size_t stack_{0u};
+  size_t max_stack_{0u};
+};
+
+// records are evaluated by blocks: values of a block are gathered into a column, comparisons and masks run the simd kernels of the cpu
+constexpr size_t kFilterBlock = 256u;
+
+static_assert(static_cast<size_t>(FilterOp::kLess) == static_cast<size_t>(CompareOp::kLess) &&
+                  static_cast<size_t>(FilterOp::kNotEqual) == static_cast<size_t>(CompareOp::kNotEqual) && kCompareOps == 6u,
+              "comparisons of the filter are indexes of the compare kernels");
+
+// selection bitmap of the records, a record without a compared value does not match the comparison
+std::vector<uint8_t> SelectRecords(const FilterProgram& program, const std::vector<FitData>& records) {
+  std::vector<uint8_t> selection(records.size(), 0u);
+  std::vector<std::array<uint8_t, kFilterBlock>> stack(program.max_stack);
+  std::array<double, kFilterBlock> values;
+  std::array<uint8_t, kFilterBlock> present;
+  const Kernels& kernels = ActiveKernels();
+  for (size_t block = 0u; block < records.size(); block += kFilterBlock) {
+    const size_t count = std::min(kFilterBlock, records.size() - block);
+    size_t top{0u};
+    for (const FilterInstruction& instruction : program.instructions) {
+      if (instruction.op == FilterOp::kAnd || instruction.op == FilterOp::kOr) {
+        (instruction.op == FilterOp::kAnd ? kernels.mask_and : kernels.mask_or)(stack[top - 2u].data(), stack[top - 1u].data(), count);
+        --top;
+        continue;
+      }
+      if (instruction.op == FilterOp::kNot) {
+        kernels.mask_not(stack[top - 1u].data(), count);
+        continue;
+      }
+
+      const uint32_t type_mask = kDataTypeMasks[instruction.type];
+      for (size_t index = 0u; index < count; ++index) {
+        const FitData& record = records[block + index];
+        values[index] = static_cast<double>(record.GetValue(instruction.type));
+        present[index] = (record.GetTypes() & type_mask) != 0u;
+      }
+      kernels.compare[static_cast<size_t>(instruction.op)](values.data(), present.data(), count, instruction.threshold, stack[top++].data());
+    }
+    std::copy_n(stack.front().begin(), count, selection.begin() + block);
+  }
+  return selection;
+}
+
+// time ranges of the selected records in fit milliseconds, widened by padding and joined when closer than join
+std::vector<std::pair<int64_t, int64_t>> SelectedSegments(const std::vector<FitData>& records,
+                                                          const std::vector<uint8_t>& selection,
+                                                          const int64_t pad_ms,
+                                                          const int64_t join_ms) {
+  std::vector<std::pair<int64_t, int64_t>> segments;
+  bool in_run{false};
+  for (size_t index = 0u; index < records.size(); ++index) {
+    if (!selection[index]) {
+      in_run = false;
+      continue;
+    }
+    const int64_t timestamp = records[index].GetValue(DataType::kTypeTimeStamp);
+    if (in_run || (!segments.empty() && (timestamp - pad_ms) - segments.back().second <= join_ms)) {
+      segments.back().second = std::max(segments.back().second, timestamp + pad_ms);
+    } else {
+      segments.emplace_back(timestamp - pad_ms, timestamp + pad_ms);
+    }
+    in_run = true;
+  }
+  return segments;
+}
+
+// exported frames of the activity in video time, smoothing is done once and every output format is written from it
+struct Timeline {
+  // vtt message cue, written before the frame
+  struct Cue {
+    size_t frame{0u};
+    int64_t from_ms{0};
+    int64_t to_ms{0};
+    std::string_view message;
+  };
+
+  std::vector<FitData> frames;
+  std::vector<Cue> cues;
+  // stopped recording between stitched inputs, paused timer and --where segments
+  std::vector<std::pair<int64_t, int64_t>> gaps;
+  std::vector<std::pair<int64_t, int64_t>> pauses;
+  std::vector<std::pair<int64_t, int64_t>> segments;
+  // mask of values DataType values: 0x01 << DataType
+  uint32_t used_data_types{0u};
+  // --where is used, only the segments are exported
+  bool filtered{false};
+  int64_t first_fit_timestamp{0};
+  int64_t first_video_timestamp{0};
+};
+
+// {"f":[ms],"rr":[ms]} R-R intervals in video time, the same as sensor samples, and only in --where segments
+void ExportHrvToJson(rapidjson::Writer<rapidjson::StringBuffer>& writer, const std::vector<HrvInterval>& hrv, const Timeline& timeline) {
+  std::vector<const HrvInterval*> exported;
+  exported.reserve(hrv.size());
+  size_t segment_index{0u};
+  for (const HrvInterval& interval : hrv) {
+    if (interval.timestamp < timeline.first_fit_timestamp) {
+      continue;
+    }
+    const int64_t video_ms = interval.timestamp - timeline.first_fit_timestamp + timeline.first_video_timestamp;
+    if (timeline.filtered) {
+      while (segment_index < timeline.segments.size() && timeline.segments[segment_index].second < video_ms) {
+        ++segment_index;
+      }
+      if (segment_index == timeline.segments.size() || timeline.segments[segment_index].first > video_ms) {
+        continue;
+      }
+    }
+    exported.push_back(&interval);
+  }
+  writer.Key("hrv");
+  writer.StartObject();
+  writer.Key(rapidjson::StringRef(kDataTypes[DataType::kTypeTimeStamp].second.data(), kDataTypes[DataType::kTypeTimeStamp].second.size()));
+  writer.StartArray();
+  for (const HrvInterval* interval_ptr : exported) {
+    writer.Int64(interval_ptr->timestamp - timeline.first_fit_timestamp + timeline.first_video_timestamp);
+  }
+  writer.EndArray();
+  writer.Key("rr");
+  writer.StartArray();
+  for (const HrvInterval* interval_ptr : exported) {
+    writer.Uint(interval_ptr->rr);
+  }
+  writer.EndArray();
+  writer.EndObject();
+}
+
+void WriteVtt(OutputBuffer& write_buffer,
+              const Timeline& timeline,
+              const DeveloperFields& developer_fields,
+              const bool imperial,
+              const CueTemplate& cue_template) {
+  write_buffer.AppendString(kVttHeaderTag);
+  size_t cue_index{0u};
+  for (size_t frame = 0u; frame <= timeline.frames.size(); ++frame) {
+    for (; cue_index < timeline.cues.size() && timeline.cues[cue_index].frame == frame; ++cue_index) {
+      const Timeline::Cue& cue = timeline.cues[cue_index];
+      WriteVttCue(write_buffer, cue.from_ms, cue.to_ms, cue.message);
+    }
+    if (frame < timeline.frames.size()) {
+      timeline.frames[frame].ExportToVtt(write_buffer, imperial, developer_fields, cue_template);
+    }
+  }
+}
+
+void WriteJson(OutputBuffer& write_buffer, const Timeline& timeline, const FitActivity& activity, const int64_t offset, const bool imperial) {
+  rapidjson::Writer<rapidjson::StringBuffer> writer(write_buffer);
+  writer.SetMaxDecimalPlaces(2);
+  writer.StartObject();
+  // records
+  writer.Key("records");
+  writer.StartArray();
+  for (const FitData& frame : timeline.frames) {
+    frame.ExportToJson(writer, imperial, activity.developer_fields);
+  }
+  writer.EndArray();
+  // stopped recording between stitched inputs and paused timer
+  ExportIntervalsToJson(writer, "gaps", timeline.gaps);
+  ExportIntervalsToJson(writer, "pauses", timeline.pauses);
+  ExportIntervalsToJson(writer, "segments", timeline.segments);
+  if (!activity.hrv.empty()) {
+    ExportHrvToJson(writer, activity.hrv, timeline);
+  }
+  uint32_t used_data_types = timeline.used_data_types;
+  if (!activity.accelerometer.timestamps.empty()) {
+    used_data_types |= kDataTypeMasks[DataType::kTypeAccelerometer];
+    ExportSensorToJson(
+        writer, DataType::kTypeAccelerometer, activity.accelerometer, timeline.first_fit_timestamp, timeline.first_video_timestamp);
+  }
+  if (!activity.gyroscope.timestamps.empty()) {
+    used_data_types |= kDataTypeMasks[DataType::kTypeGyroscope];
+    ExportSensorToJson(writer, DataType::kTypeGyroscope, activity.gyroscope, timeline.first_fit_timestamp, timeline.first_video_timestamp);
+  }
+  if (activity.developer_fields.HasValues()) {
+    writer.Key(rapidjson::StringRef(kDataTypes[DataType::kTypeDeveloper].first.data(), kDataTypes[DataType::kTypeDeveloper].first.size()));
+    activity.developer_fields.ExportLegendToJson(writer);
+  }
+  writer.Key("types");
+  writer.StartObject();
+  // types legend
+  for (uint32_t type = DataType::kTypeFirst; type < DataType::kTypeMax; ++type) {
+    writer.Key(rapidjson::StringRef(kDataTypes[type].first.data(), kDataTypes[type].first.size()));
+    writer.Uint64(kDataTypeMasks[type]);
+  }
+  writer.EndObject();
+  writer.Key("fields");
+  writer.StartObject();
+  // types legend
+  for (uint32_t type = DataType::kTypeFirst; type < DataType::kTypeMax; ++type) {
+    writer.Key(rapidjson::StringRef(kDataTypes[type].first.data(), kDataTypes[type].first.size()));
+    writer.String(rapidjson::StringRef(kDataTypes[type].second.data(), kDataTypes[type].second.size()));
+  }
+  writer.EndObject();
+  writer.Key("usedTypes");
+  writer.Uint64(used_data_types);
+  writer.Key("timestamp");
+  writer.Int64(timeline.first_fit_timestamp);
+  writer.Key("offset");
+  writer.Int64(offset);
+  writer.Key("units");
+  if (imperial) {
+    writer.String(rapidjson::StringRef(kValuesImperial.data(), kValuesImperial.size()));
+  } else {
+    writer.String(rapidjson::StringRef(kValuesMetric.data(), kValuesMetric.size()));
+  }
+  writer.EndObject();
+}
+
+}  // namespace
+
+// names line delimited by commas
+uint32_t DataTypeNamesToMask(std::string_view names) {
+  std::vector<std::string_view> types;
+  size_t start = 0u;
+  size_t end = 0u;
+
+  while ((end = names.find(",", start)) != std::string::npos) {
+    const std::string_view tag(names.substr(start, end - start));
+    if (tag.size() > 0u) {
+      types.emplace_back(tag);
+    }
+    start = end + 1u;
+  }
+  const std::string_view last_tag(names.substr(start, names.size()));
+  if (last_tag.size() > 0u) {
+    types.emplace_back(last_tag);  // last token
+  }
+
+  uint32_t types_mask = 0u;
+  for (auto type : types) {
+    const auto dt = NameToDataType(type);
+    if (dt != DataType::kTypeMax) {
+      types_mask |= DataTypeToMask(dt);
+    }
+  }
+
+  return types_mask;
+}
+
+bool DeriveNamesToMask(std::string_view names, uint32_t& mask) {
+  if (names == kDeriveNone) {
+    mask = 0u;
+    return true;
+  }
+  const uint32_t derivable_mask =
+      kDataTypeMasks[DataType::kTypeSpeed] | kDataTypeMasks[DataType::kTypeDistance] | kDataTypeMasks[DataType::kTypeGrade];
+  uint32_t names_mask{0u};
+  for (size_t start = 0u; start <= names.size();) {
+    const size_t end = std::min(names.find(',', start), names.size());
+    const DataType type = NameToDataType(names.substr(start, end - start));
+    if (type == DataType::kTypeMax || (kDataTypeMasks[type] & derivable_mask) == 0u) {
+      return false;
+    }
+    names_mask |= kDataTypeMasks[type];
+    start = end + 1u;
+  }
+  mask = names_mask;
+  return true;
+}
+
+uint32_t DefaultDeriveDataTypes() {
+  uint32_t mask{0u};
+  DeriveNamesToMask(kDeriveDefault, mask);
+  return mask;
+}
+
+bool DecodeTrack(DataSource& data_source, std::vector<TrackPoint>& track) {
+  const uint32_t position_data_types =
+      DataTypeToMask(DataType::kTypeTimeStamp) | DataTypeToMask(DataType::kTypeLatitude) | DataTypeToMask(DataType::kTypeLongitude);
+  auto [fit_status, activity] = DecodeSource(data_source, position_data_types);
+  if (fit_status != FIT_CONVERT_END_OF_FILE) {
+    return false;
+  }
+  SortActivity(activity);
+  track.clear();
+  track.reserve(activity.records.size());
+  for (const FitData& record : activity.records) {
+    if ((record.GetTypes() & position_data_types) == position_data_types) {
+      track.push_back({static_cast<int32_t>(record.GetValue(DataType::kTypeLatitude)),
+                       static_cast<int32_t>(record.GetValue(DataType::kTypeLongitude)),
+                       static_cast<uint32_t>(record.GetValue(DataType::kTypeTimeStamp) / 1000)});
+    }
+  }
+  return true;
+}
+
+bool DecodeColumns(DataSource& data_source, const uint32_t datatypes, const bool imperial, RecordColumns& columns) {
+  constexpr std::array<DataType, 9> kColumnTypes = {DataType::kTypeSpeed,   DataType::kTypeDistance,    DataType::kTypeHeartRate,
+                                                    DataType::kTypeAltitude, DataType::kTypePower,       DataType::kTypeCadence,
+                                                    DataType::kTypeTemperature, DataType::kTypeLatitude, DataType::kTypeLongitude};
+  constexpr double kDegreesToSemicircles = 2147483648.0 / 180.0;
+  auto [fit_status, activity] = DecodeSource(data_source, datatypes | DataTypeToMask(DataType::kTypeTimeStamp));
+  if (fit_status != FIT_CONVERT_END_OF_FILE) {
+    return false;
+  }
+  SortActivity(activity);
+  const std::vector<FitData>& records = activity.records;
+  columns.timestamps.resize(records.size());
+  uint32_t used_types{0u};
+  for (size_t index = 0u; index < records.size(); ++index) {
+    columns.timestamps[index] = records[index].GetValue(DataType::kTypeTimeStamp);
+    used_types |= records[index].GetTypes();
+  }
+
+  columns.columns.clear();
+  for (const DataType type : kColumnTypes) {
+    const uint32_t type_mask = kDataTypeMasks[type];
+    if ((used_types & type_mask) == 0u) {
+      continue;
+    }
+    double scale{kDegreesToSemicircles};
+    double shift{0.0};
+    if (type != DataType::kTypeLatitude && type != DataType::kTypeLongitude) {
+      OutputUnits(type, imperial, scale, shift);
+    }
+    std::vector<double>& values = columns.columns.emplace_back(kDataTypes[type].first, std::vector<double>(records.size())).second;
+    for (size_t index = 0u; index < records.size(); ++index) {
+      values[index] = (records[index].GetTypes() & type_mask) != 0u ? (static_cast<double>(records[index].GetValue(type)) - shift) / scale
+                                                                    : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  return true;
+}
+
+std::vector<std::unique_ptr<FitResult>> Convert(std::vector<std::unique_ptr<DataSource>> data_sources,
+                                                const std::vector<std::string_view>& output_types,
+                                                const int64_t offset,
+                                                const uint8_t smoothness,
+                                                const uint32_t collect_data_types,
+                                                const bool imperial,
+                                                ConvertOptions options) {
+  std::vector<std::unique_ptr<FitResult>> results;
+  for (size_t index = 0u; index < output_types.size(); ++index) {
+    results.push_back(std::make_unique<FitResult>());
+    results.back()->first = ParseResult::kError;
+  }
+
+  uint32_t file_items{0u};
+  Timeline timeline;
+
+  size_t data_source_size{0u};
+  for (const auto& data_source_ptr : data_sources) {
+    data_source_size += data_source_ptr->GetSize();
+  }
+
+  MergePriorities priorities;
+  if (!ParseMergePriorities(options.merge_priorities, data_sources.size(), priorities)) {
+    SPDLOG_ERROR("wrong merge priorities: '{}'", options.merge_priorities);
+    return results;
+  }
+
+  CueTemplate cue_template;
+  if (!options.cue_template.empty() && !cue_template.Compile(options.cue_template, imperial)) {
+    SPDLOG_ERROR("wrong cue template: '{}'", options.cue_template);
+    return results;
+  }
+
+  FilterProgram filter;
+  if (!options.where.empty()) {
+    if (!FilterCompiler(options.where, imperial).Compile(filter)) {
+      SPDLOG_ERROR("wrong filter expression: '{}'", options.where);
+      return results;
+    }
+    if ((filter.data_types & collect_data_types) != filter.data_types) {
+      SPDLOG_WARN("filter uses data that is not processed, it never matches");
+    }
+  }
+
+  // decode pass: hr messages may come after the records (swim files), so everything is collected first
+  FitActivity activity;
+  FIT_CONVERT_RETURN fit_status = (options.inputs_mode == InputsMode::kMerge)
+                                            ? MergeSources(data_sources, collect_data_types, priorities, activity)
+                                            : StitchSources(data_sources, collect_data_types, activity);
+
+  // the reference ride is needed for its distance and time only
+  FitActivity reference_activity;
+  if (fit_status == FIT_CONVERT_END_OF_FILE && options.reference_source) {
+    const uint32_t reference_data_types = kDataTypeMasks[DataType::kTypeTimeStamp] | kDataTypeMasks[DataType::kTypeDistance] |
+                                          kDataTypeMasks[DataType::kTypeSpeed] | kDataTypeMasks[DataType::kTypeLatitude] |
+                                          kDataTypeMasks[DataType::kTypeLongitude];
+    auto [reference_status, decoded_reference] = DecodeSource(*options.reference_source, reference_data_types);
+    if (reference_status != FIT_CONVERT_END_OF_FILE) {
+      SPDLOG_ERROR("reference .fit file can not be decoded");
+      fit_status = reference_status;
+    }
+    reference_activity = std::move(decoded_reference);
+    SortActivity(reference_activity);
+    DeriveActivity(reference_activity.records, reference_data_types);
+  }
+
+  if (fit_status == FIT_CONVERT_END_OF_FILE) {
+    SortActivity(activity);
+    MergeHeartRate(activity.records, activity.heart_rate);
+    if (!options.elevation_directory.empty() && (collect_data_types & kDataTypeMasks[DataType::kTypeAltitude])) {
+      DemTiles dem(options.elevation_directory);
+      const size_t corrected = CorrectAltitude(activity.records, dem);
+      SPDLOG_INFO("altitude corrected by elevation tiles: {} of {} records", corrected, activity.records.size());
+    }
+    DeriveActivity(activity.records, options.derive_data_types & collect_data_types);
+    if (options.reference_source) {
+      const DistanceIndex reference(reference_activity.records);
+      if (reference.Size() < 2u) {
+        SPDLOG_WARN("reference .fit file has no distance to compare with");
+      }
+      CompareActivity(activity.records, reference, collect_data_types);
+    }
+    // matched segments in fit time, records out of them are not exported
+    std::vector<std::pair<int64_t, int64_t>> segments;
+    if (!filter.instructions.empty()) {
+      segments = SelectedSegments(
+          activity.records, SelectRecords(filter, activity.records), std::max<int64_t>(0, options.where_pad_ms), options.where_join_ms);
+      SPDLOG_INFO("filter '{}' matches {} segment(s)", options.where, segments.size());
+    }
+    size_t segment_index{0u};
+
+    // smoothing runs once, the frames are written by every output format
+    timeline.frames.reserve(activity.records.size() * (smoothness + 1u));
+    auto Export = [&timeline](const FitData* fit_data_ptr) { timeline.frames.push_back(*fit_data_ptr); };
+    int64_t& first_fit_timestamp = timeline.first_fit_timestamp;
+    int64_t& first_video_timestamp = timeline.first_video_timestamp;
+
+    // gaps between stitched inputs and timer pauses: no values are interpolated over them
+    std::vector<std::tuple<int64_t, int64_t, bool>> stops;  // from, to, is pause
+    stops.reserve(activity.gaps.size() + activity.pauses.size());
+    for (const auto& [from_ms, to_ms] : activity.gaps) {
+      stops.emplace_back(from_ms, to_ms, false);
+    }
+    for (const auto& [from_ms, to_ms] : activity.pauses) {
+      stops.emplace_back(from_ms, to_ms, true);
+    }
+    std::sort(stops.begin(), stops.end(), [](const auto& left, const auto& right) { return std::get<1>(left) < std::get<1>(right); });
+    size_t stop_index{0u};
+
+    FitData* previous_fit_data_ptr = nullptr;
+    for (FitData& fit_data : activity.records) {
+      // timestamp in milliseconds
+      const int64_t type_msec = fit_data.GetValue(DataType::kTypeTimeStamp);
+      // fit timestamp should not be 0, because it's milliseconds since UTC 00:00 Dec 31 1989
+      if (0 == first_fit_timestamp) {
+        first_fit_timestamp = type_msec;
+        if (offset > 0) {
+          first_fit_timestamp += offset;
+        } else if (offset < 0) {
+          first_video_timestamp = std::abs(offset);
+          // message that .fit data is not yet ready
+          timeline.cues.push_back({0u, 0, first_video_timestamp, kVttOffsetMessage});
+        }
+      }
+
+      if (offset > 0) {
+        // positive offset, 'offset' second of the data from .fit file will displayed at the first second of the video
+        if (type_msec < first_fit_timestamp) {
+          continue;
+        }
+      }
+
+      // the record starts the next stitched input or follows a pause, a gap wins if there are both
+      bool after_gap{false};
+      bool after_pause{false};
+      while (stop_index < stops.size() && std::get<1>(stops[stop_index]) <= type_msec) {
+        (std::get<2>(stops[stop_index]) ? after_pause : after_gap) = true;
+        ++stop_index;
+      }
 
-      // reset timestamp to video data (+offset), ONLY AFTER ApplyData!
+      // reset timestamp to video data (+offset)
       const int64_t new_fit_from_ms = (type_msec - first_fit_timestamp) + first_video_timestamp;
-      new_fit_data_ptr->SetValue(DataType::kTypeTimeStamp, new_fit_from_ms);
+      if (!filter.instructions.empty()) {
+        while (segment_index < segments.size() && segments[segment_index].second < type_msec) {
+          ++segment_index;
+        }
+        if (segment_index == segments.size() || segments[segment_index].first > type_msec) {
+          // the segment is over, its last record is not interpolated to the next one
+          if (previous_fit_data_ptr != nullptr) {
+            const int64_t previous_ms = previous_fit_data_ptr->GetValue(DataType::kTypeTimeStamp);
+            previous_fit_data_ptr->SetValue(DataType::kTypeTimeStampNext, previous_ms + std::min(kLastItemMs, new_fit_from_ms - previous_ms));
+            Export(previous_fit_data_ptr);
+            previous_fit_data_ptr = nullptr;
+          }
+          continue;
+        }
+      }
+      fit_data.SetValue(DataType::kTypeTimeStamp, new_fit_from_ms);
       // apply to global flags
-      used_data_types |= new_fit_data_ptr->GetTypes();
+      timeline.used_data_types |= fit_data.GetTypes();
       ++file_items;
-      std::swap(previous_fot_data_ptr, new_fit_data_ptr);
-      if (new_fit_data_ptr == nullptr) {
-        new_fit_data_ptr = &previous_fit_data;
+      if (previous_fit_data_ptr == nullptr) {
+        previous_fit_data_ptr = &fit_data;
         continue;
       }
-      // process new_fit_data_ptr (actually the previous one as we swaped them) and we have new one in previous_fit_data_ptr
+      if (after_gap || after_pause) {
+        // no values are interpolated over the stopped recording or the paused timer
+        const int64_t previous_ms = previous_fit_data_ptr->GetValue(DataType::kTypeTimeStamp);
+        const int64_t gap_from_ms = previous_ms + std::min(kLastItemMs, new_fit_from_ms - previous_ms);
+        previous_fit_data_ptr->SetValue(DataType::kTypeTimeStampNext, gap_from_ms);
+        Export(previous_fit_data_ptr);
+        if (gap_from_ms < new_fit_from_ms) {
+          timeline.cues.push_back({timeline.frames.size(), gap_from_ms, new_fit_from_ms, after_gap ? kVttGapMessage : kVttPauseMessage});
+          (after_gap ? timeline.gaps : timeline.pauses).emplace_back(gap_from_ms, new_fit_from_ms);
+        }
+        previous_fit_data_ptr = &fit_data;
+        continue;
+      }
+      // export previous record, the current one is used as the end of its time frame
+      FitData export_data = *previous_fit_data_ptr;
       if (smoothness > 0u) {
-        const int64_t smoothed_diff_ms = (new_fit_from_ms - new_fit_data_ptr->GetValue(DataType::kTypeTimeStamp)) / (smoothness + 1u);
-        new_fit_data_ptr->SetValue(DataType::kTypeTimeStampNext, new_fit_data_ptr->GetValue(DataType::kTypeTimeStamp) + smoothed_diff_ms);
-        Export(new_fit_data_ptr);
+        const int64_t smoothed_diff_ms = (new_fit_from_ms - export_data.GetValue(DataType::kTypeTimeStamp)) / (smoothness + 1u);
+        export_data.SetValue(DataType::kTypeTimeStampNext, export_data.GetValue(DataType::kTypeTimeStamp) + smoothed_diff_ms);
+        Export(&export_data);
 
-        FitData diff = *previous_fot_data_ptr - *new_fit_data_ptr;
+        FitData diff = fit_data - export_data;
         diff = diff / (smoothness + 1u);
         for (uint8_t cur_step = 0u; cur_step < smoothness; ++cur_step) {
-          *new_fit_data_ptr = *new_fit_data_ptr + diff;
-          new_fit_data_ptr->SetValue(DataType::kTypeTimeStampNext, new_fit_data_ptr->GetValue(DataType::kTypeTimeStamp) + smoothed_diff_ms);
-          Export(new_fit_data_ptr);
+          export_data = export_data + diff;
+          export_data.SetValue(DataType::kTypeTimeStampNext, export_data.GetValue(DataType::kTypeTimeStamp) + smoothed_diff_ms);
+          Export(&export_data);
         }
       } else {
-        new_fit_data_ptr->SetValue(DataType::kTypeTimeStampNext, new_fit_from_ms);
-        Export(new_fit_data_ptr);
+        export_data.SetValue(DataType::kTypeTimeStampNext, new_fit_from_ms);
+        Export(&export_data);
       }
+      previous_fit_data_ptr = &fit_data;
     }
-  }
 
-  if (fit_status == FIT_CONVERT_END_OF_FILE) {
-    // success
-    result->first = ParseResult::kSuccess;
-
-    // finish json
-    if (previous_fot_data_ptr != nullptr) {
+    if (previous_fit_data_ptr != nullptr) {
       // save last item
-      previous_fot_data_ptr->SetValue(
+      previous_fit_data_ptr->SetValue(
           DataType::kTypeTimeStampNext,
-          previous_fot_data_ptr->GetValue(DataType::kTypeTimeStamp) + 1000);  // last item have no the next, to take time from
-      Export(previous_fot_data_ptr);
-      if (vtt_output) {
-        const Time start(previous_fot_data_ptr->GetValue(DataType::kTypeTimeStampNext));
-        const Time end(previous_fot_data_ptr->GetValue(DataType::kTypeTimeStampNext) + 60000);
-        std::array<char, 32> formatting_buffer;
-        const size_t size_start = format_timestamp(formatting_buffer.data(), formatting_buffer.size(), start);
-        write_buffer.AppendString(formatting_buffer.data(), size_start);
-        write_buffer.AppendString(kVttTimeSeparator);
-        const size_t size_end = format_timestamp(formatting_buffer.data(), formatting_buffer.size(), end);
-        write_buffer.AppendString(formatting_buffer.data(), size_end);
-        write_buffer.AppendString(kVttEndMessage);
-        write_buffer.AppendString(kVttMessage);
-      }
-    }
-
-    if (json_output) {
-      // records
-      writer.EndArray();
-      writer.Key("types");
-      writer.StartObject();
-      // types legend
-      for (uint32_t type = DataType::kTypeFirst; type < DataType::kTypeMax; ++type) {
-        writer.Key(rapidjson::StringRef(kDataTypes[type].first.data(), kDataTypes[type].first.size()));
-        writer.Uint64(kDataTypeMasks[type]);
-      }
-      writer.EndObject();
-      writer.Key("fields");
-      writer.StartObject();
-      // types legend
-      for (uint32_t type = DataType::kTypeFirst; type < DataType::kTypeMax; ++type) {
-        writer.Key(rapidjson::StringRef(kDataTypes[type].first.data(), kDataTypes[type].first.size()));
-        writer.String(rapidjson::StringRef(kDataTypes[type].second.data(), kDataTypes[type].second.size()));
-      }
-      writer.EndObject();
-      writer.Key("usedTypes");
-      writer.Uint64(used_data_types);
-      writer.Key("timestamp");
-      writer.Int64(first_fit_timestamp);
-      writer.Key("offset");
-      writer.Int64(offset);
-      writer.Key("units");
-      if (imperial) {
-        writer.String(rapidjson::StringRef(kValuesImperial.data(), kValuesImperial.size()));
-      } else {
-        writer.String(rapidjson::StringRef(kValuesMetric.data(), kValuesMetric.size()));
+          previous_fit_data_ptr->GetValue(DataType::kTypeTimeStamp) + kLastItemMs);  // last item have no the next, to take time from
+      Export(previous_fit_data_ptr);
+      const int64_t end_ms = previous_fit_data_ptr->GetValue(DataType::kTypeTimeStampNext);
+      timeline.cues.push_back({timeline.frames.size(), end_ms, end_ms + 60000, kVttEndMessage});
+    }
+    if (!filter.instructions.empty()) {
+      timeline.filtered = true;
+      // matched segments, padding can reach out of the video
+      for (const auto& [from_ms, to_ms] : segments) {
+        const int64_t video_from_ms = std::max(first_video_timestamp, (from_ms - first_fit_timestamp) + first_video_timestamp);
+        const int64_t video_to_ms = (to_ms - first_fit_timestamp) + first_video_timestamp;
+        if (video_to_ms >= video_from_ms) {
+          timeline.segments.emplace_back(video_from_ms, video_to_ms);
+        }
       }
-      writer.EndObject();
     }
 
-    result->second = std::move(write_buffer);
+    // every output format has its own buffer and is written concurrently
+    const size_t reserve_size = data_source_size == 0u ? (2048u * 1024u) : (data_source_size + (data_source_size >> 2u));
+    auto emit = [&](const size_t index) {
+      OutputBuffer write_buffer;
+      write_buffer.Reserve(reserve_size);
+      if (output_types[index] == kOutputJsonTag) {
+        WriteJson(write_buffer, timeline, activity, offset, imperial);
+      } else if (output_types[index] == kOutputVttTag) {
+        WriteVtt(write_buffer, timeline, activity.developer_fields, imperial, cue_template);
+      }
+      results[index]->second = std::move(write_buffer);
+      results[index]->first = ParseResult::kSuccess;
+    };
+    std::vector<std::future<void>> emitters;
+    for (size_t index = 1u; index < output_types.size(); ++index) {
+      emitters.push_back(std::async(std::launch::async, emit, index));
+    }
+    if (!output_types.empty()) {
+      emit(0u);
+    }
+    for (auto& emitter : emitters) {
+      emitter.get();
+    }
 
   } else if (fit_status == FIT_CONVERT_ERROR) {
     SPDLOG_ERROR("error decoding file");
@@ -823,6 +3210,38 @@ std::unique_ptr<FitResult> Convert(std::unique_ptr<DataSource> data_source_ptr,
   }
 
   // will not work for cout output
-  SPDLOG_INFO("fit records processed: {}, source size: {}, non items: {}", file_items, data_source_size, non_msg_counter);
-  return result;
+  SPDLOG_INFO("fit records processed: {}, source size: {}, inputs: {}, files: {}, non items: {}, hr beats: {}, hrv intervals: {}, accelerometer: {}, gyroscope: {}",
+              file_items,
+              data_source_size,
+              data_sources.size(),
+              activity.files,
+              activity.non_msg_counter,
+              activity.heart_rate.size(),
+              activity.hrv.size(),
+              activity.accelerometer.timestamps.size(),
+              activity.gyroscope.timestamps.size());
+  return results;
+}
+
+std::unique_ptr<FitResult> Convert(std::vector<std::unique_ptr<DataSource>> data_sources,
+                                   const std::string_view output_type,
+                                   const int64_t offset,
+                                   const uint8_t smoothness,
+                                   const uint32_t collect_data_types,
+                                   const bool imperial,
+                                   ConvertOptions options) {
+  return std::move(
+      Convert(std::move(data_sources), std::vector<std::string_view>{output_type}, offset, smoothness, collect_data_types, imperial, std::move(options))
+          .front());
+}
+
+std::unique_ptr<FitResult> Convert(std::unique_ptr<DataSource> data_source_ptr,
+                                   const std::string_view output_type,
+                                   const int64_t offset,
+                                   const uint8_t smoothness,
+                                   const uint32_t collect_data_types,
+                                   const bool imperial) {
+  std::vector<std::unique_ptr<DataSource>> data_sources;
+  data_sources.push_back(std::move(data_source_ptr));
+  return Convert(std::move(data_sources), output_type, offset, smoothness, collect_data_types, imperial, ConvertOptions{});
 }
@@ -49,9 +49,12 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "datasource.h"
+#include "spatial_index.h"
 
 enum class ParseResult {
   kSuccess,
@@ -60,17 +63,89 @@ enum class ParseResult {
 
 using FitResult = std::pair<ParseResult, rapidjson::StringBuffer>;
 
+// how several inputs are combined
+enum class InputsMode {
+  kStitch,  // sequential recordings of one activity
+  kMerge,   // the same activity recorded by several devices at once
+};
+
+// data computed by default when the file has none: speed and distance from positions
+inline constexpr std::string_view kDeriveDefault = "speed,distance";
+// nothing is computed
+inline constexpr std::string_view kDeriveNone = "none";
+
+// "speed", "distance" and "grade" divided by comma to the datatypes mask, "none" is 0, false if a name can not be computed
+bool DeriveNamesToMask(std::string_view names, uint32_t& mask);
+
+// datatypes mask of kDeriveDefault
+uint32_t DefaultDeriveDataTypes();
+
+// processing of several inputs and the decoded activity
+struct ConvertOptions {
+  InputsMode inputs_mode{InputsMode::kStitch};
+  // "power=2,cadence=2" - input number (from 1) to take the field from first, merge mode only
+  std::string merge_priorities;
+  // reference ride to compare with at the same distance, optional
+  std::unique_ptr<DataSource> reference_source;
+  // datatypes mask of the fields computed from positions and altitude when the file has none, the same default for every entry point
+  uint32_t derive_data_types{DefaultDeriveDataTypes()};
+  // directory with .hgt elevation tiles to correct altitude by position, optional
+  std::string elevation_directory;
+  // "power > 400 && grade > 8" - only the segments where the records match are exported, optional
+  std::string where;
+  // milliseconds added around the matched segments and the largest distance between segments to join them
+  int64_t where_pad_ms{0};
+  int64_t where_join_ms{0};
+  // vtt cue text with {field} or {field:precision:width} in place of the values, "{hr}bpm {power}W\n{speed:1}", optional
+  std::string cue_template;
+};
+
 inline constexpr std::string_view kOutputJsonTag = "json";
 inline constexpr std::string_view kOutputVttTag = "vtt";
+inline constexpr std::string_view kOutputIndexTag = "index";
+inline constexpr std::string_view kOutputLocateTag = "locate";
+inline constexpr std::string_view kOutputFitTag = "fit";
 inline constexpr std::string_view kValuesMetric = "metric";
 inline constexpr std::string_view kValuesImperial = "imperial";
 
 // convert datatypes divided by comma to datatypes mask, 0 - means error
 uint32_t DataTypeNamesToMask(std::string_view name);
 
+// time ordered positions of the activity for the spatial index, false if it can not be decoded
+bool DecodeTrack(DataSource& data_source, std::vector<TrackPoint>& track);
+
+// time ordered records by columns for bindings, without per record objects
+struct RecordColumns {
+  // milliseconds since UTC 00:00 Dec 31 1989
+  std::vector<int64_t> timestamps;
+  // values of every data type some record has in the values format, latitude and longitude in degrees, NaN where a record has none
+  std::vector<std::pair<std::string_view, std::vector<double>>> columns;
+};
+
+// false if it can not be decoded
+bool DecodeColumns(DataSource& data_source, const uint32_t datatypes, const bool imperial, RecordColumns& columns);
+
 std::unique_ptr<FitResult> Convert(std::unique_ptr<DataSource> data_source_ptr,
                                    const std::string_view output_type,
                                    const int64_t offset,
                                    const uint8_t smoothness,
                                    const uint32_t datatypes,
                                    const bool imperial);
+
+// several inputs are recordings of one activity, they are stitched or merged into one timeline
+std::unique_ptr<FitResult> Convert(std::vector<std::unique_ptr<DataSource>> data_sources,
+                                   const std::string_view output_type,
+                                   const int64_t offset,
+                                   const uint8_t smoothness,
+                                   const uint32_t datatypes,
+                                   const bool imperial,
+                                   ConvertOptions options);
+
+// one decode and smoothing for several output types, every format is written concurrently, results are in the output types order
+std::vector<std::unique_ptr<FitResult>> Convert(std::vector<std::unique_ptr<DataSource>> data_sources,
+                                                const std::vector<std::string_view>& output_types,
+                                                const int64_t offset,
+                                                const uint8_t smoothness,
+                                                const uint32_t datatypes,
+                                                const bool imperial,
+                                                ConvertOptions options);
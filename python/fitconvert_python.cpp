@@ -0,0 +1,153 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Python module of the decoder: record columns are NumPy arrays over the decoded buffers, the GIL is released while a file
+// is decoded or converted so thread pools decode in parallel
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl/filesystem.h>
+#include <spdlog/spdlog.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../datasource.h"
+#include "../parser.h"
+
+namespace py = pybind11;
+
+namespace {
+
+// data types names divided by comma, all of them when empty
+uint32_t DataTypesMask(const std::string& data_types) {
+  if (data_types.empty()) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  const uint32_t mask = DataTypeNamesToMask(data_types);
+  if (mask == 0u) {
+    throw py::value_error("unknown data types: " + data_types);
+  }
+  return mask;
+}
+
+// columns are moved into the capsule the arrays are based on, it is freed with the last of them
+py::dict ColumnsToArrays(std::unique_ptr<RecordColumns> columns_ptr) {
+  RecordColumns* columns = columns_ptr.get();
+  const py::capsule owner(columns_ptr.release(), [](void* columns) { delete static_cast<RecordColumns*>(columns); });
+  py::dict arrays;
+  arrays["timestamp"] = py::array_t<int64_t>(static_cast<py::ssize_t>(columns->timestamps.size()), columns->timestamps.data(), owner);
+  for (auto& [name, values] : columns->columns) {
+    arrays[py::str(name.data(), name.size())] = py::array_t<double>(static_cast<py::ssize_t>(values.size()), values.data(), owner);
+  }
+  return arrays;
+}
+
+py::dict DecodeSourceColumns(DataSource& data_source, const std::string& data_types, const bool imperial) {
+  const uint32_t datatypes = DataTypesMask(data_types);
+  auto columns_ptr = std::make_unique<RecordColumns>();
+  bool decoded{false};
+  {
+    py::gil_scoped_release release;
+    decoded = DecodeColumns(data_source, datatypes, imperial, *columns_ptr);
+  }
+  if (!decoded) {
+    throw py::value_error(".fit file can not be decoded");
+  }
+  return ColumnsToArrays(std::move(columns_ptr));
+}
+
+py::dict Decode(const py::buffer& data, const std::string& data_types, const bool imperial) {
+  // the buffer is kept by the request while the GIL is released
+  const py::buffer_info info = data.request();
+  DataSourceMemory data_source(static_cast<const uint8_t*>(info.ptr), static_cast<size_t>(info.size * info.itemsize));
+  return DecodeSourceColumns(data_source, data_types, imperial);
+}
+
+py::dict DecodeFile(const std::filesystem::path& path, const std::string& data_types, const bool imperial) {
+  DataSourceFile data_source(path.string());
+  return DecodeSourceColumns(data_source, data_types, imperial);
+}
+
+py::str ConvertBuffer(const py::buffer& data,
+                      const std::string_view type,
+                      const int64_t offset,
+                      const uint8_t smoothness,
+                      const std::string& data_types,
+                      const bool imperial,
+                      const std::string& derive,
+                      const std::string& cue_template) {
+  const uint32_t datatypes = DataTypesMask(data_types);
+  ConvertOptions options;
+  if (!DeriveNamesToMask(derive, options.derive_data_types)) {
+    throw py::value_error("unknown data to compute: " + derive);
+  }
+  options.cue_template = cue_template;
+  const py::buffer_info info = data.request();
+  std::unique_ptr<FitResult> result;
+  {
+    py::gil_scoped_release release;
+    std::vector<std::unique_ptr<DataSource>> data_sources;
+    data_sources.push_back(std::make_unique<DataSourceMemory>(static_cast<const uint8_t*>(info.ptr), static_cast<size_t>(info.size * info.itemsize)));
+    result = Convert(std::move(data_sources), type, offset, smoothness, datatypes, imperial, std::move(options));
+  }
+  if (result->first != ParseResult::kSuccess) {
+    throw py::value_error(".fit file can not be converted");
+  }
+  return py::str(result->second.GetString(), result->second.GetSize());
+}
+
+}  // namespace
+
+PYBIND11_MODULE(fitconvert, m) {
+  m.doc() = "Decoder of .fit activities into NumPy columns and converter to WebVTT and JSON overlays";
+  // statistics of every file are not printed by a library
+  spdlog::set_level(spdlog::level::err);
+
+  m.attr("FIT_EPOCH") = 631065600;
+
+  m.def("decode", &Decode, py::arg("data"), py::kw_only(), py::arg("data_types") = "", py::arg("imperial") = false,
+             "Record columns of a .fit file in a bytes-like object: 'timestamp' in milliseconds since FIT_EPOCH (int64) and a "
+             "float64 array of every data type the records have, NaN where a record has no value. The arrays share the "
+             "decoded buffers, nothing is copied.");
+  m.def("decode_file", &DecodeFile, py::arg("path"), py::kw_only(), py::arg("data_types") = "", py::arg("imperial") = false,
+             "decode() of a .fit file by its path.");
+  m.def(
+      "to_vtt",
+      [](const py::buffer& data, const int64_t offset, const uint8_t smoothness, const std::string& data_types, const bool imperial,
+         const std::string& derive, const std::string& cue_template) {
+        return ConvertBuffer(data, kOutputVttTag, offset, smoothness, data_types, imperial, derive, cue_template);
+      },
+      py::arg("data"), py::kw_only(), py::arg("offset") = 0, py::arg("smoothness") = 0, py::arg("data_types") = "", py::arg("imperial") = false,
+      py::arg("derive") = std::string(kDeriveDefault), py::arg("template") = "",
+      "WebVTT subtitles of a .fit file in a bytes-like object, the same as fitconvert -t vtt: 'derive' is -g, data computed "
+      "from the positions when the records have none, 'none' turns it off.");
+  m.def(
+      "to_json",
+      [](const py::buffer& data, const int64_t offset, const uint8_t smoothness, const std::string& data_types, const bool imperial,
+         const std::string& derive) { return ConvertBuffer(data, kOutputJsonTag, offset, smoothness, data_types, imperial, derive, {}); },
+      py::arg("data"), py::kw_only(), py::arg("offset") = 0, py::arg("smoothness") = 0, py::arg("data_types") = "", py::arg("imperial") = false,
+      py::arg("derive") = std::string(kDeriveDefault), "JSON of a .fit file in a bytes-like object, the same as fitconvert -t json, 'derive' as in to_vtt().");
+}
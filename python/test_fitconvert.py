@@ -0,0 +1,86 @@
+# python -m unittest discover -s python, the built module is found by PYTHONPATH
+
+import json
+import struct
+import unittest
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+import fitconvert
+
+CRC_TABLE = [0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+             0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400]
+
+
+def crc16(data, crc=0):
+    for byte in data:
+        tmp = CRC_TABLE[crc & 0xF]
+        crc = ((crc >> 4) & 0x0FFF) ^ tmp ^ CRC_TABLE[byte & 0xF]
+        tmp = CRC_TABLE[crc & 0xF]
+        crc = ((crc >> 4) & 0x0FFF) ^ tmp ^ CRC_TABLE[(byte >> 4) & 0xF]
+    return crc
+
+
+def make_fit_file(timestamp, records):
+    """records of timestamp and heart rate, the same as in tests.cpp"""
+    data = bytearray([0x40, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFD, 0x04, 0x86, 0x03, 0x01, 0x02])
+    for index in range(records):
+        data += struct.pack('<BIB', 0, timestamp + index, 100 + index % 100)
+    header = bytearray(struct.pack('<BBHI4s', 14, 0x20, 2167, len(data), b'.FIT'))
+    header += struct.pack('<H', crc16(header))
+    file = header + data
+    return bytes(file + struct.pack('<H', crc16(file)))
+
+
+class DecodeTest(unittest.TestCase):
+    def test_columns(self):
+        columns = fitconvert.decode(make_fit_file(1000, 30))
+        self.assertEqual(set(columns), {'timestamp', 'heartrate'})
+        self.assertEqual(columns['timestamp'].dtype, np.int64)
+        np.testing.assert_array_equal(columns['timestamp'], 1000000 + np.arange(30) * 1000)
+        np.testing.assert_array_equal(columns['heartrate'], 100.0 + np.arange(30))
+
+    def test_arrays_share_buffers(self):
+        columns = fitconvert.decode(memoryview(make_fit_file(1000, 10)))
+        for array in columns.values():
+            self.assertFalse(array.flags.owndata)
+            self.assertIsNotNone(array.base)
+
+    def test_broken_file(self):
+        file = bytearray(make_fit_file(1000, 10))
+        file[-1] ^= 0xFF
+        with self.assertRaises(ValueError):
+            fitconvert.decode(file)
+        with self.assertRaises(ValueError):
+            fitconvert.decode(make_fit_file(1000, 10), data_types='colour')
+
+    def test_threads(self):
+        files = [make_fit_file(1000 + index, 2000) for index in range(8)]
+        with ThreadPoolExecutor(4) as pool:
+            decoded = list(pool.map(fitconvert.decode, files))
+        for index, columns in enumerate(decoded):
+            self.assertEqual(columns['timestamp'][0], (1000 + index) * 1000)
+
+
+class ConvertTest(unittest.TestCase):
+    def test_vtt(self):
+        vtt = fitconvert.to_vtt(make_fit_file(1000, 5), template='{hr}bpm')
+        self.assertTrue(vtt.startswith('WEBVTT'))
+        self.assertIn('104bpm', vtt)
+
+    def test_json(self):
+        converted = json.loads(fitconvert.to_json(make_fit_file(1000, 5), offset=500, smoothness=3))
+        self.assertEqual(converted['offset'], 500)
+        self.assertEqual(converted['units'], 'metric')
+
+    def test_derive(self):
+        file = make_fit_file(1000, 5)
+        self.assertEqual(fitconvert.to_json(file), fitconvert.to_json(file, derive='speed,distance'))
+        json.loads(fitconvert.to_json(file, derive='none'))
+        with self.assertRaises(ValueError):
+            fitconvert.to_vtt(file, derive='sped')
+
+
+if __name__ == '__main__':
+    unittest.main()
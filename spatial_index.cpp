@@ -0,0 +1,332 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "spatial_index.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+constexpr std::array<char, 8> kIndexMagic = {'F', 'I', 'T', 'I', 'D', 'X', '\0', '\0'};
+constexpr uint32_t kIndexVersion = 1u;
+
+// cells are geohash-like: 16 bits of latitude and 16 bits of longitude interleaved, about 300 x 600 m at the equator
+constexpr uint32_t kCellSide = 1u << 16u;
+constexpr double kEarthRadiusM = 6371008.8;
+constexpr double kMetersPerDegree = kEarthRadiusM * std::numbers::pi / 180.0;
+constexpr double kSemicirclesToDegrees = 180.0 / 2147483648.0;
+// points of one activity closer in time belong to the same pass
+constexpr uint32_t kPassGapS = 60u;
+
+// file layout, little-endian: header, tracks, cells (+ end marker), postings, points, names
+struct IndexHeader {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t tracks;
+  uint64_t cells;
+  uint64_t postings;
+  uint64_t points;
+  uint64_t names_size;
+};
+
+struct IndexTrack {
+  uint64_t name_offset;
+  uint32_t name_size;
+  uint32_t first_point;
+  uint32_t points;
+  uint32_t reserved;
+};
+
+struct IndexCell {
+  uint32_t cell;
+  uint32_t first_posting;
+};
+
+// run of the track points in one cell
+struct IndexPosting {
+  uint32_t track;
+  uint32_t first_point;
+  uint32_t points;
+};
+
+static_assert(sizeof(IndexHeader) == 48u && sizeof(IndexTrack) == 24u && sizeof(IndexCell) == 8u && sizeof(IndexPosting) == 12u &&
+              sizeof(TrackPoint) == 12u);
+
+uint32_t CellLatitude(const double latitude) {
+  const double position = std::floor((latitude + 90.0) / 180.0 * kCellSide);
+  return static_cast<uint32_t>(std::clamp(position, 0.0, static_cast<double>(kCellSide - 1u)));
+}
+
+int64_t CellLongitude(const double longitude) {
+  return static_cast<int64_t>(std::floor((longitude + 180.0) / 360.0 * kCellSide));
+}
+
+// 0x0000abcd -> 0x0a0b0c0d by bits
+uint32_t SpreadBits(uint32_t value) {
+  value = (value | (value << 8u)) & 0x00FF00FFu;
+  value = (value | (value << 4u)) & 0x0F0F0F0Fu;
+  value = (value | (value << 2u)) & 0x33333333u;
+  value = (value | (value << 1u)) & 0x55555555u;
+  return value;
+}
+
+// 0x0a0b0c0d -> 0x0000abcd by bits, the inverse of SpreadBits
+uint32_t CompactBits(uint32_t value) {
+  value &= 0x55555555u;
+  value = (value | (value >> 1u)) & 0x33333333u;
+  value = (value | (value >> 2u)) & 0x0F0F0F0Fu;
+  value = (value | (value >> 4u)) & 0x00FF00FFu;
+  value = (value | (value >> 8u)) & 0x0000FFFFu;
+  return value;
+}
+
+// longitude takes the high bit of every pair as in geohash
+uint32_t MakeCell(const uint32_t latitude_cell, const uint32_t longitude_cell) {
+  return (SpreadBits(longitude_cell) << 1u) | SpreadBits(latitude_cell);
+}
+
+uint32_t PointCell(const TrackPoint& point) {
+  const int64_t longitude_cell = CellLongitude(point.longitude * kSemicirclesToDegrees);
+  return MakeCell(CellLatitude(point.latitude * kSemicirclesToDegrees), static_cast<uint32_t>(longitude_cell) & (kCellSide - 1u));
+}
+
+double DistanceM(const double latitude1, const double longitude1, const double latitude2, const double longitude2) {
+  constexpr double kRadians = std::numbers::pi / 180.0;
+  const double sin_latitude = std::sin((latitude2 - latitude1) * kRadians * 0.5);
+  const double sin_longitude = std::sin((longitude2 - longitude1) * kRadians * 0.5);
+  const double a = sin_latitude * sin_latitude + std::cos(latitude1 * kRadians) * std::cos(latitude2 * kRadians) * sin_longitude * sin_longitude;
+  return 2.0 * kEarthRadiusM * std::asin(std::sqrt(std::min(1.0, a)));
+}
+
+template <typename T>
+const T* Section(const uint8_t* data_ptr, const size_t data_size, uint64_t& offset, const uint64_t count) {
+  const uint64_t size = count * sizeof(T);
+  if (offset > data_size || size / sizeof(T) != count || size > data_size - offset || offset % alignof(T) != 0u) {
+    throw std::runtime_error("spatial index is truncated");
+  }
+  const T* section_ptr = reinterpret_cast<const T*>(data_ptr + offset);
+  offset += size;
+  return section_ptr;
+}
+
+struct IndexView {
+  const IndexHeader* header_ptr{nullptr};
+  const IndexTrack* tracks_ptr{nullptr};
+  const IndexCell* cells_ptr{nullptr};
+  const IndexPosting* postings_ptr{nullptr};
+  const TrackPoint* points_ptr{nullptr};
+  const char* names_ptr{nullptr};
+};
+
+IndexView MakeView(const MappedFile& file) {
+  IndexView view;
+  uint64_t offset{0u};
+  view.header_ptr = Section<IndexHeader>(file.GetData(), file.GetSize(), offset, 1u);
+  if (view.header_ptr->magic != kIndexMagic || view.header_ptr->version != kIndexVersion) {
+    throw std::runtime_error("not a spatial index file");
+  }
+  view.tracks_ptr = Section<IndexTrack>(file.GetData(), file.GetSize(), offset, view.header_ptr->tracks);
+  view.cells_ptr = Section<IndexCell>(file.GetData(), file.GetSize(), offset, view.header_ptr->cells + 1u);
+  view.postings_ptr = Section<IndexPosting>(file.GetData(), file.GetSize(), offset, view.header_ptr->postings);
+  view.points_ptr = Section<TrackPoint>(file.GetData(), file.GetSize(), offset, view.header_ptr->points);
+  view.names_ptr = Section<char>(file.GetData(), file.GetSize(), offset, view.header_ptr->names_size);
+  return view;
+}
+
+}  // namespace
+
+void SpatialIndexBuilder::AddTrack(std::string name, const std::vector<TrackPoint>& track) {
+  Track& added = tracks_.emplace_back();
+  added.name = std::move(name);
+  for (const TrackPoint& point : track) {
+    if (!added.points.empty()) {
+      const TrackPoint& last = added.points.back();
+      if (DistanceM(last.latitude * kSemicirclesToDegrees,
+                    last.longitude * kSemicirclesToDegrees,
+                    point.latitude * kSemicirclesToDegrees,
+                    point.longitude * kSemicirclesToDegrees) < kMinStepM) {
+        continue;
+      }
+    }
+    added.points.push_back(point);
+  }
+}
+
+void SpatialIndexBuilder::Write(const std::filesystem::path& path) const {
+  std::vector<size_t> order(tracks_.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::sort(order.begin(), order.end(), [this](const size_t left, const size_t right) { return tracks_[left].name < tracks_[right].name; });
+
+  std::vector<IndexTrack> tracks;
+  std::vector<TrackPoint> points;
+  std::string names;
+  // cell and the run of points in it
+  std::vector<std::pair<uint32_t, IndexPosting>> postings;
+  for (const size_t track_index : order) {
+    const Track& track = tracks_[track_index];
+    const uint32_t index = static_cast<uint32_t>(tracks.size());
+    const uint32_t first_point = static_cast<uint32_t>(points.size());
+    tracks.push_back({names.size(), static_cast<uint32_t>(track.name.size()), first_point, static_cast<uint32_t>(track.points.size()), 0u});
+    names += track.name;
+    for (const TrackPoint& point : track.points) {
+      const uint32_t cell = PointCell(point);
+      const uint32_t point_index = static_cast<uint32_t>(points.size());
+      if (point_index == first_point || postings.back().first != cell) {
+        postings.push_back({cell, {index, point_index, 0u}});
+      }
+      ++postings.back().second.points;
+      points.push_back(point);
+    }
+  }
+  std::sort(postings.begin(), postings.end(), [](const auto& left, const auto& right) {
+    return std::tie(left.first, left.second.track, left.second.first_point) < std::tie(right.first, right.second.track, right.second.first_point);
+  });
+
+  std::vector<IndexCell> cells;
+  std::vector<IndexPosting> cell_postings;
+  cell_postings.reserve(postings.size());
+  for (const auto& [cell, posting] : postings) {
+    if (cells.empty() || cells.back().cell != cell) {
+      cells.push_back({cell, static_cast<uint32_t>(cell_postings.size())});
+    }
+    cell_postings.push_back(posting);
+  }
+  IndexHeader header{kIndexMagic, kIndexVersion, static_cast<uint32_t>(tracks.size()), cells.size(), cell_postings.size(), points.size(), names.size()};
+  // end marker, postings of the last cell end at it
+  cells.push_back({0xFFFFFFFFu, static_cast<uint32_t>(cell_postings.size())});
+
+  std::ofstream stream(path, std::ios::out | std::ios::trunc | std::ios::binary);
+  stream.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+  auto write = [&stream](const auto* data_ptr, const size_t count) {
+    stream.write(reinterpret_cast<const char*>(data_ptr), static_cast<std::streamsize>(count * sizeof(*data_ptr)));
+  };
+  write(&header, 1u);
+  write(tracks.data(), tracks.size());
+  write(cells.data(), cells.size());
+  write(cell_postings.data(), cell_postings.size());
+  write(points.data(), points.size());
+  write(names.data(), names.size());
+}
+
+SpatialIndex::SpatialIndex(const std::filesystem::path& path) : file_(std::make_unique<MappedFile>(path)) {
+  MakeView(*file_);
+}
+
+size_t SpatialIndex::GetTracks() const noexcept {
+  return reinterpret_cast<const IndexHeader*>(file_->GetData())->tracks;
+}
+
+std::vector<TrackPass> SpatialIndex::Query(const double latitude, const double longitude, const double radius_m) const {
+  const IndexView view = MakeView(*file_);
+  const IndexCell* cells_begin_ptr = view.cells_ptr;
+  const IndexCell* cells_end_ptr = view.cells_ptr + view.header_ptr->cells;
+
+  // cells of the bounding box of the circle
+  if (!std::isfinite(latitude) || !std::isfinite(longitude) || !std::isfinite(radius_m)) {
+    return {};
+  }
+  const double radius_degrees = std::max(0.0, radius_m) / kMetersPerDegree;
+  const uint32_t latitude_from = CellLatitude(latitude - radius_degrees);
+  const uint32_t latitude_to = CellLatitude(latitude + radius_degrees);
+  const double latitude_cos = std::cos(std::min(89.9, std::abs(latitude) + radius_degrees) * std::numbers::pi / 180.0);
+  const double longitude_degrees = radius_degrees / latitude_cos;
+  int64_t longitude_from = CellLongitude(longitude - longitude_degrees);
+  int64_t longitude_to = CellLongitude(longitude + longitude_degrees);
+  if (longitude_to - longitude_from >= static_cast<int64_t>(kCellSide)) {
+    longitude_from = 0;
+    longitude_to = kCellSide - 1u;
+  }
+
+  // track, point, distance
+  std::vector<std::tuple<uint32_t, uint32_t, double>> matches;
+  auto match_cell = [&](const IndexCell* cell_ptr) {
+    for (uint32_t posting_index = cell_ptr->first_posting; posting_index < (cell_ptr + 1)->first_posting; ++posting_index) {
+      const IndexPosting& posting = view.postings_ptr[posting_index];
+      for (uint32_t point_index = posting.first_point; point_index < posting.first_point + posting.points; ++point_index) {
+        const TrackPoint& point = view.points_ptr[point_index];
+        const double distance =
+            DistanceM(latitude, longitude, point.latitude * kSemicirclesToDegrees, point.longitude * kSemicirclesToDegrees);
+        if (distance <= radius_m) {
+          matches.emplace_back(posting.track, point_index, distance);
+        }
+      }
+    }
+  };
+  const uint64_t box_cells = static_cast<uint64_t>(latitude_to - latitude_from + 1u) * static_cast<uint64_t>(longitude_to - longitude_from + 1);
+  if (box_cells > view.header_ptr->cells) {
+    // a large box has fewer of the stored cells than its own, they are checked instead of searched for
+    const uint64_t longitude_span = static_cast<uint64_t>(longitude_to - longitude_from);
+    for (const IndexCell* cell_ptr = cells_begin_ptr; cell_ptr != cells_end_ptr; ++cell_ptr) {
+      const uint32_t latitude_cell = CompactBits(cell_ptr->cell);
+      const uint64_t longitude_cell = static_cast<uint64_t>(CompactBits(cell_ptr->cell >> 1u) - longitude_from) & (kCellSide - 1u);
+      if (latitude_cell >= latitude_from && latitude_cell <= latitude_to && longitude_cell <= longitude_span) {
+        match_cell(cell_ptr);
+      }
+    }
+  } else {
+    for (uint32_t latitude_cell = latitude_from; latitude_cell <= latitude_to; ++latitude_cell) {
+      for (int64_t longitude_cell = longitude_from; longitude_cell <= longitude_to; ++longitude_cell) {
+        const uint32_t cell = MakeCell(latitude_cell, static_cast<uint32_t>(longitude_cell) & (kCellSide - 1u));
+        const IndexCell* found_ptr =
+            std::lower_bound(cells_begin_ptr, cells_end_ptr, cell, [](const IndexCell& left, const uint32_t value) { return left.cell < value; });
+        if (found_ptr != cells_end_ptr && found_ptr->cell == cell) {
+          match_cell(found_ptr);
+        }
+      }
+    }
+  }
+  std::sort(matches.begin(), matches.end());
+
+  // consecutive points of a track make one pass, reported at the closest point
+  std::vector<TrackPass> passes;
+  for (size_t index = 0u; index < matches.size(); ++index) {
+    const auto [track_index, point_index, distance] = matches[index];
+    const IndexTrack& track = view.tracks_ptr[track_index];
+    const TrackPoint& point = view.points_ptr[point_index];
+    bool same_pass{false};
+    if (index > 0u && std::get<0>(matches[index - 1u]) == track_index) {
+      const TrackPoint& previous = view.points_ptr[std::get<1>(matches[index - 1u])];
+      same_pass = point.timestamp - previous.timestamp <= kPassGapS;
+    }
+    if (same_pass) {
+      if (distance < passes.back().distance) {
+        passes.back().timestamp = point.timestamp;
+        passes.back().offset = static_cast<int64_t>(point.timestamp - view.points_ptr[track.first_point].timestamp) * 1000;
+        passes.back().distance = distance;
+      }
+      continue;
+    }
+    TrackPass& pass = passes.emplace_back();
+    pass.name = std::string_view(view.names_ptr + track.name_offset, track.name_size);
+    pass.timestamp = point.timestamp;
+    pass.offset = static_cast<int64_t>(point.timestamp - view.points_ptr[track.first_point].timestamp) * 1000;
+    pass.distance = distance;
+  }
+  return passes;
+}
@@ -0,0 +1,92 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mapped_file.h"
+
+// position of a track for the spatial index
+struct TrackPoint {
+  // semicircles
+  int32_t latitude{0};
+  int32_t longitude{0};
+  // seconds since UTC 00:00 Dec 31 1989
+  uint32_t timestamp{0u};
+};
+
+// collects tracks of a library of activities and writes them as a spatial index file
+class SpatialIndexBuilder {
+ public:
+  // track points are in time order, points closer than kMinStepM to the previous one are skipped
+  void AddTrack(std::string name, const std::vector<TrackPoint>& track);
+
+  size_t GetTracks() const noexcept { return tracks_.size(); }
+
+  // activities are written in the name order, throws on io errors
+  void Write(const std::filesystem::path& path) const;
+
+  static constexpr double kMinStepM = 10.0;
+
+ private:
+  struct Track {
+    std::string name;
+    std::vector<TrackPoint> points;
+  };
+
+  std::vector<Track> tracks_;
+};
+
+// one pass of an activity near the queried place, at the track point closest to it
+struct TrackPass {
+  std::string_view name;
+  // seconds since UTC 00:00 Dec 31 1989
+  uint32_t timestamp{0u};
+  // milliseconds from the first track point, the offset for the video of this place
+  int64_t offset{0};
+  // meters to the place
+  double distance{0.0};
+};
+
+// memory mapped spatial index: track points of the activities in an inverted index by geohash cells
+class SpatialIndex {
+ public:
+  // throws if the file can not be mapped or is not an index
+  explicit SpatialIndex(const std::filesystem::path& path);
+
+  // passes of all activities within the radius of the place in degrees, by activity name and time
+  std::vector<TrackPass> Query(const double latitude, const double longitude, const double radius_m) const;
+
+  size_t GetTracks() const noexcept;
+
+  // the largest radius of a place the command line accepts
+  static constexpr double kMaxRadiusM = 100000.0;
+
+ private:
+  std::unique_ptr<MappedFile> file_;
+};
@@ -22,9 +22,22 @@
 #include <spdlog/spdlog.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
 
+#include "batch.h"
+#include "fit_rewrite.h"
+#include "fitconvert.h"
+#include "fitsdk/fit_crc.h"
 #include "gtest/gtest.h"
 #include "parser.cpp"
+#include "watch.h"
 
 
 namespace {
@@ -112,6 +125,873 @@ TEST(ValuesFormattingWithSuffix, Positive) {
   }
 }
 
+TEST(HeartRate, UnpackTimestamps12) {
+  const std::array<uint16_t, kHrEventTimestamps> expected = {0x123, 0x456, 0x789, 0xABC, 0xDEF, 0x000, 0xFFF, 0x801};
+  std::array<FIT_BYTE, FIT_HR_MESG_EVENT_TIMESTAMP_12_COUNT> packed;
+  for (size_t index = 0u; index < expected.size(); index += 2u) {
+    packed[index / 2u * 3u] = static_cast<FIT_BYTE>(expected[index] & 0xFF);
+    packed[index / 2u * 3u + 1u] = static_cast<FIT_BYTE>((expected[index] >> 8) | ((expected[index + 1u] & 0x0F) << 4));
+    packed[index / 2u * 3u + 2u] = static_cast<FIT_BYTE>(expected[index + 1u] >> 4);
+  }
+  std::array<uint16_t, kHrEventTimestamps> unpacked;
+  UnpackTimestamps12(packed.data(), unpacked);
+  EXPECT_EQ(unpacked, expected);
+}
+
+TEST(SensorStream, Calibration) {
+  SensorCalibration calibration;
+  calibration.scale = 0.001f;
+  calibration.level_shift = 2048.0f;
+  calibration.offset = {10.0f, 0.0f, -10.0f};
+  // swap x and y
+  calibration.rotation = {0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  std::vector<float> x = {3058.0f, 2058.0f};
+  std::vector<float> y = {2048.0f, 4048.0f};
+  std::vector<float> z = {1038.0f, 2038.0f};
+  CalibrateSensorSamples(x.data(), y.data(), z.data(), x.size(), calibration);
+  EXPECT_FLOAT_EQ(x[0], 0.0f);
+  EXPECT_FLOAT_EQ(y[0], 1.0f);
+  EXPECT_FLOAT_EQ(z[0], -1.0f);
+  EXPECT_FLOAT_EQ(x[1], 2.0f);
+  EXPECT_FLOAT_EQ(y[1], 0.0f);
+  EXPECT_FLOAT_EQ(z[1], 0.0f);
+}
+
+TEST(DeveloperFields, BigEndianWithScale) {
+  FIT_FIELD_DESCRIPTION_MESG description;
+  Fit_InitMesg(Fit_GetMesgDef(FIT_MESG_NUM_FIELD_DESCRIPTION), &description);
+  description.developer_data_index = 0;
+  description.field_definition_number = 1;
+  description.fit_base_type_id = FIT_BASE_TYPE_SINT16;
+  description.scale = 10;
+  std::strcpy(description.field_name, "core_temperature");
+  std::strcpy(description.units, "C");
+  DeveloperFields developer_fields;
+  developer_fields.ApplyDescription(&description);
+
+  // unknown field, then the described one
+  const std::array<FIT_CONVERT_DEV_FIELD, 2> dev_fields = {{{0, 0, 1, 0}, {1, 1, 2, 0}}};
+  const std::array<FIT_UINT8, 3> valid = {0x00, 0x01, 0x73};
+  const std::array<FIT_UINT8, 3> invalid = {0x00, 0x7F, 0xFF};
+  EXPECT_TRUE(developer_fields.ApplyData(0u, dev_fields.data(), dev_fields.size(), valid.data(), FIT_ARCH_ENDIAN_BIG));
+  EXPECT_FALSE(developer_fields.ApplyData(1u, dev_fields.data(), dev_fields.size(), invalid.data(), FIT_ARCH_ENDIAN_BIG));
+  EXPECT_TRUE(developer_fields.HasValues());
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.SetMaxDecimalPlaces(2);
+  writer.StartObject();
+  developer_fields.ExportToJson(writer, 0u);
+  developer_fields.ExportToJson(writer, 1u);
+  writer.EndObject();
+  EXPECT_EQ(std::string_view(buffer.GetString(), buffer.GetSize()), R"({"core_temperature":37.1})");
+}
+
+// record definition of timestamp and heart rate
+constexpr std::array<uint8_t, 12> kRecordDefinition = {0x40, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFD, 0x04, 0x86, 0x03, 0x01, 0x02};
+
+void AppendRecords(std::vector<uint8_t>& data, const uint32_t timestamp, const size_t records) {
+  for (size_t index = 0u; index < records; ++index) {
+    const uint32_t record_timestamp = timestamp + static_cast<uint32_t>(index);
+    data.push_back(0x00);
+    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&record_timestamp), reinterpret_cast<const uint8_t*>(&record_timestamp) + 4);
+    data.push_back(static_cast<uint8_t>(100u + index));
+  }
+}
+
+// header and crc around the messages
+std::vector<uint8_t> WrapFitFile(const std::vector<uint8_t>& data) {
+  const uint32_t data_size = static_cast<uint32_t>(data.size());
+  std::vector<uint8_t> file = {14, 0x20, 0x77, 0x08};
+  file.insert(file.end(), reinterpret_cast<const uint8_t*>(&data_size), reinterpret_cast<const uint8_t*>(&data_size) + 4);
+  file.insert(file.end(), {'.', 'F', 'I', 'T'});
+  const FIT_UINT16 header_crc = FitCRC_Calc16(file.data(), static_cast<FIT_UINT32>(file.size()));
+  file.push_back(static_cast<uint8_t>(header_crc & 0xFF));
+  file.push_back(static_cast<uint8_t>(header_crc >> 8));
+  file.insert(file.end(), data.begin(), data.end());
+  const FIT_UINT16 crc = FitCRC_Calc16(file.data(), static_cast<FIT_UINT32>(file.size()));
+  file.push_back(static_cast<uint8_t>(crc & 0xFF));
+  file.push_back(static_cast<uint8_t>(crc >> 8));
+  return file;
+}
+
+// minimal .fit file with records of timestamp and heart rate
+std::vector<uint8_t> MakeFitFile(const uint32_t timestamp, const size_t records) {
+  std::vector<uint8_t> data(kRecordDefinition.begin(), kRecordDefinition.end());
+  AppendRecords(data, timestamp, records);
+  return WrapFitFile(data);
+}
+
+TEST(ChainedFiles, DecodeInParallel) {
+  std::vector<uint8_t> data;
+  for (const uint32_t start : {1000u, 2000u, 1500u}) {
+    const std::vector<uint8_t> file = MakeFitFile(start, 3u);
+    data.insert(data.end(), file.begin(), file.end());
+  }
+  data.insert(data.end(), 5u, 0u);  // padding after the last file
+
+  const auto files = FindChainedFiles(data.data(), data.size());
+  ASSERT_EQ(files.size(), 3u);
+  EXPECT_EQ(files[1].first, files[0].second);
+
+  auto decoded_files = DecodeChainedFiles(data.data(), files, 0xFFFFFFFF);
+  FitActivity activity;
+  for (auto& [status, file_activity] : decoded_files) {
+    EXPECT_EQ(status, FIT_CONVERT_END_OF_FILE);
+    AppendActivity(activity, file_activity);
+  }
+  SortActivity(activity);
+  EXPECT_EQ(activity.files, 3u);
+  ASSERT_EQ(activity.records.size(), 9u);
+  EXPECT_EQ(activity.records.front().GetValue(DataType::kTypeTimeStamp), 1000000);
+  EXPECT_EQ(activity.records[3].GetValue(DataType::kTypeTimeStamp), 1500000);
+  EXPECT_EQ(activity.records.back().GetValue(DataType::kTypeTimeStamp), 2002000);
+  EXPECT_EQ(activity.records.back().GetValue(DataType::kTypeHeartRate), 102);
+}
+
+TEST(FitDecoderState, UndefinedLocalTypeIsSkipped) {
+  // the local type 5 is defined in the first file only
+  std::vector<uint8_t> defined(kRecordDefinition.begin(), kRecordDefinition.end());
+  defined[0] = 0x45;
+  defined.insert(defined.end(), {0x05, 0xE8, 0x03, 0x00, 0x00, 0x50});
+  const std::vector<uint8_t> first_file = WrapFitFile(defined);
+  // data message header of the local type 5 without a definition between the records
+  std::vector<uint8_t> data(kRecordDefinition.begin(), kRecordDefinition.end());
+  AppendRecords(data, 1000u, 2u);
+  data.push_back(0x05);
+  AppendRecords(data, 1002u, 1u);
+  const std::vector<uint8_t> second_file = WrapFitFile(data);
+
+  // the second decoder is constructed over the state of the first one, it must not see its definitions
+  alignas(FitDecoder) std::array<uint8_t, sizeof(FitDecoder)> storage;
+  FitDecoder* decoder_ptr = new (storage.data()) FitDecoder(0xFFFFFFFF);
+  EXPECT_EQ(decoder_ptr->Read(first_file.data(), first_file.size()), FIT_CONVERT_END_OF_FILE);
+  EXPECT_EQ(decoder_ptr->GetActivity().records.size(), 1u);
+  decoder_ptr->~FitDecoder();
+  decoder_ptr = new (storage.data()) FitDecoder(0xFFFFFFFF);
+  EXPECT_EQ(decoder_ptr->Read(second_file.data(), second_file.size()), FIT_CONVERT_END_OF_FILE);
+  const std::vector<FitData> records = std::move(decoder_ptr->GetActivity().records);
+  decoder_ptr->~FitDecoder();
+  ASSERT_EQ(records.size(), 3u);
+  EXPECT_EQ(records.back().GetValue(DataType::kTypeTimeStamp), 1002000);
+  EXPECT_EQ(records.back().GetValue(DataType::kTypeHeartRate), 100);
+}
+
+TEST(HeartRate, HrvOnVideoTimeline) {
+  // a record with heart rate 100 + s and two intervals of 500 ms every second, beats are not recorded for 6 seconds before 1010
+  std::vector<uint8_t> data(kRecordDefinition.begin(), kRecordDefinition.end());
+  data.insert(data.end(), {0x41, 0x00, 0x00, 0x4E, 0x00, 0x01, 0x00, 0x04, 0x84});
+  for (const uint32_t timestamp : {1000u, 1001u, 1002u, 1003u, 1010u}) {
+    data.push_back(0x00);
+    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&timestamp), reinterpret_cast<const uint8_t*>(&timestamp) + 4);
+    data.push_back(static_cast<uint8_t>(100u + timestamp - 1000u));
+    data.insert(data.end(), {0x01, 0xF4, 0x01, 0xF4, 0x01});
+  }
+  const std::vector<uint8_t> file = WrapFitFile(data);
+
+  auto hrv = [&file](ConvertOptions options) {
+    std::vector<std::unique_ptr<DataSource>> data_sources;
+    data_sources.push_back(std::make_unique<DataSourceMemory>(file.data(), file.size()));
+    const auto result = Convert(std::move(data_sources), kOutputJsonTag, 1000, 0u, 0xFFFFFFFF, false, std::move(options));
+    EXPECT_EQ(result->first, ParseResult::kSuccess);
+    const std::string_view json(result->second.GetString(), result->second.GetSize());
+    const size_t position = json.find(R"("hrv":)");
+    return position == std::string_view::npos ? std::string() : std::string(json.substr(position, json.find('}', position) + 1u - position));
+  };
+  // the first second is cut by the offset
+  EXPECT_EQ(hrv(ConvertOptions{}), R"("hrv":{"f":[0,500,1000,1500,2000,2500,3000,9500,10000],"rr":[500,500,500,500,500,500,500,500,500]})");
+  ConvertOptions where;
+  where.where = "heartrate > 109";
+  where.where_pad_ms = 1000;
+  EXPECT_EQ(hrv(std::move(where)), R"("hrv":{"f":[9500,10000],"rr":[500,500]})");
+}
+
+TEST(StitchedInputs, OrderedWithGap) {
+  const std::vector<uint8_t> late = MakeFitFile(1100u, 2u);
+  const std::vector<uint8_t> early = MakeFitFile(1000u, 3u);
+  std::vector<std::unique_ptr<DataSource>> data_sources;
+  data_sources.push_back(std::make_unique<DataSourceMemory>(late.data(), late.size()));
+  data_sources.push_back(std::make_unique<DataSourceMemory>(early.data(), early.size()));
+
+  FitActivity activity;
+  EXPECT_EQ(StitchSources(data_sources, 0xFFFFFFFF, activity), FIT_CONVERT_END_OF_FILE);
+  EXPECT_EQ(activity.files, 2u);
+  ASSERT_EQ(activity.records.size(), 5u);
+  EXPECT_EQ(activity.records.front().GetValue(DataType::kTypeTimeStamp), 1000000);
+  EXPECT_EQ(activity.records[3].GetValue(DataType::kTypeTimeStamp), 1100000);
+  ASSERT_EQ(activity.gaps.size(), 1u);
+  EXPECT_EQ(activity.gaps.front().first, 1002000);
+  EXPECT_EQ(activity.gaps.front().second, 1100000);
+}
+
+TEST(TimerPauses, NoSmoothingOverPause) {
+  // records at 1000-1002 and 1010-1011, the timer is stopped at 1002 and started at 1010
+  std::vector<uint8_t> data(kRecordDefinition.begin(), kRecordDefinition.end());
+  const std::vector<uint8_t> event_definition = {0x41, 0x00, 0x00, 0x15, 0x00, 0x03, 0xFD, 0x04, 0x86, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00};
+  data.insert(data.end(), event_definition.begin(), event_definition.end());
+  auto append_event = [&data](const uint32_t timestamp, const uint8_t event_type) {
+    data.push_back(0x01);
+    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&timestamp), reinterpret_cast<const uint8_t*>(&timestamp) + 4);
+    data.push_back(FIT_EVENT_TIMER);
+    data.push_back(event_type);
+  };
+  append_event(1000u, FIT_EVENT_TYPE_START);
+  AppendRecords(data, 1000u, 3u);
+  append_event(1002u, FIT_EVENT_TYPE_STOP_ALL);
+  append_event(1010u, FIT_EVENT_TYPE_START);
+  AppendRecords(data, 1010u, 2u);
+  // stopped at the end, not a pause
+  append_event(1011u, FIT_EVENT_TYPE_STOP_ALL);
+  const std::vector<uint8_t> file = WrapFitFile(data);
+
+  DataSourceMemory data_source(file.data(), file.size());
+  const auto [status, activity] = DecodeSource(data_source, 0xFFFFFFFF);
+  EXPECT_EQ(status, FIT_CONVERT_END_OF_FILE);
+  ASSERT_EQ(activity.pauses.size(), 1u);
+  EXPECT_EQ(activity.pauses.front().first, 1002000);
+  EXPECT_EQ(activity.pauses.front().second, 1010000);
+
+  const auto result = Convert(std::make_unique<DataSourceMemory>(file.data(), file.size()), kOutputJsonTag, 0, 3u, 0xFFFFFFFF, false);
+  ASSERT_EQ(result->first, ParseResult::kSuccess);
+  const std::string_view json(result->second.GetString(), result->second.GetSize());
+  EXPECT_NE(json.find(R"("pauses":[{"from":3000,"to":10000}])"), std::string_view::npos);
+  EXPECT_EQ(json.find(R"("gaps")"), std::string_view::npos);
+  // 3 seconds of records smoothed by 4 cues each, one cue for the record before the pause and the last one
+  size_t records{0u};
+  for (size_t position = json.find(R"({"f":)"); position != std::string_view::npos; position = json.find(R"({"f":)", position + 1u)) {
+    ++records;
+  }
+  EXPECT_EQ(records, 3u * 4u + 1u + 1u);
+}
+
+TEST(FanOut, FormatsOfOneDecode) {
+  const std::vector<uint8_t> file = MakeFitFile(1000u, 30u);
+  const std::vector<std::string_view> types{kOutputVttTag, kOutputJsonTag, kOutputVttTag};
+  std::vector<std::unique_ptr<DataSource>> data_sources;
+  data_sources.push_back(std::make_unique<DataSourceMemory>(file.data(), file.size()));
+  const auto results = Convert(std::move(data_sources), types, 500, 3u, 0xFFFFFFFF, false, ConvertOptions{});
+  ASSERT_EQ(results.size(), types.size());
+
+  for (size_t index = 0u; index < types.size(); ++index) {
+    const auto single = Convert(std::make_unique<DataSourceMemory>(file.data(), file.size()), types[index], 500, 3u, 0xFFFFFFFF, false);
+    ASSERT_EQ(results[index]->first, ParseResult::kSuccess);
+    ASSERT_EQ(single->first, ParseResult::kSuccess);
+    EXPECT_EQ(std::string_view(results[index]->second.GetString(), results[index]->second.GetSize()),
+              std::string_view(single->second.GetString(), single->second.GetSize()));
+  }
+}
+
+TEST(CueTemplate, CompiledLayout) {
+  CueTemplate cue_template;
+  ASSERT_TRUE(cue_template.Compile(R"({hr}bpm {{{power}}}W\n{speed:1} {grade:0:4}%)", false));
+  // literal runs are copied by one instruction
+  EXPECT_EQ(cue_template.GetInstructions().size(), 8u);
+  for (const std::string_view wrong : {"{hr", "hr}", "{unknown}", "{speed:x}", "{speed:1:99}", "{timestamp}"}) {
+    EXPECT_FALSE(CueTemplate().Compile(wrong, false)) << wrong;
+  }
+
+  FitData record;
+  record.MergeValue(DataType::kTypeTimeStamp, 1000);
+  record.MergeValue(DataType::kTypeTimeStampNext, 2000);
+  record.MergeValue(DataType::kTypeHeartRate, 142);
+  record.MergeValue(DataType::kTypeSpeed, 10000);
+  record.MergeValue(DataType::kTypeGrade, 420);
+  OutputBuffer buffer;
+  record.ExportToVtt(buffer, false, DeveloperFields(), cue_template);
+  EXPECT_EQ(std::string_view(buffer.GetString(), buffer.GetSize()), "00:00:01.000 --> 00:00:02.000\n142bpm {--}W\n36.0    4%\n\n");
+
+  // the sign of a delta is inside the width
+  CueTemplate delta_template;
+  ASSERT_TRUE(delta_template.Compile("[{timedelta:1:6}][{timedelta:1}][{timedelta:1:3}]", false));
+  for (const auto& [milliseconds, expected] : {std::pair{3500, "[  +3.5][+3.5][+3.5]"}, std::pair{-3500, "[  -3.5][-3.5][-3.5]"}}) {
+    FitData delta;
+    delta.MergeValue(DataType::kTypeTimeStamp, 1000);
+    delta.MergeValue(DataType::kTypeTimeStampNext, 2000);
+    delta.MergeValue(DataType::kTypeTimeDelta, milliseconds);
+    OutputBuffer delta_buffer;
+    delta.ExportToVtt(delta_buffer, false, DeveloperFields(), delta_template);
+    EXPECT_EQ(std::string_view(delta_buffer.GetString(), delta_buffer.GetSize()),
+              std::string("00:00:01.000 --> 00:00:02.000\n") + expected + "\n\n");
+  }
+}
+
+TEST(MergedInputs, ClockSkewAndPriorities) {
+  // the bike computer clock is 5 seconds ahead of the watch
+  std::vector<FitActivity> activities(2u);
+  for (int64_t second = 0; second < 120; ++second) {
+    const int64_t heart_rate = 130 + static_cast<int64_t>(20.0 * std::sin(static_cast<double>(second) / 7.0));
+    FitData watch;
+    watch.MergeValue(DataType::kTypeTimeStamp, second * 1000);
+    watch.MergeValue(DataType::kTypeHeartRate, heart_rate);
+    activities[0].records.push_back(watch);
+    FitData bike;
+    bike.MergeValue(DataType::kTypeTimeStamp, (second + 5) * 1000);
+    bike.MergeValue(DataType::kTypeHeartRate, heart_rate + 1);
+    bike.MergeValue(DataType::kTypePower, 200 + second);
+    activities[1].records.push_back(bike);
+  }
+
+  // a record with the invalid timestamp is sorted to the end and is not a part of the overlap
+  FitData invalid;
+  invalid.MergeValue(DataType::kTypeTimeStamp, kInvalidTimestampMs);
+  invalid.MergeValue(DataType::kTypeHeartRate, 100);
+  std::vector<FitData> with_invalid = activities[1].records;
+  with_invalid.push_back(invalid);
+  EXPECT_EQ(EstimateClockSkew(activities[0].records, with_invalid), -5000);
+  // the overlap of clocks that are days apart is not searched
+  std::vector<FitData> long_overlap = activities[0].records;
+  long_overlap.back().SetValue(DataType::kTypeTimeStamp, 3 * 24 * 3600 * 1000);
+  std::vector<FitData> long_overlap_input = activities[1].records;
+  long_overlap_input.front().SetValue(DataType::kTypeTimeStamp, -3 * 24 * 3600 * 1000);
+  long_overlap_input.back().SetValue(DataType::kTypeTimeStamp, 4 * 24 * 3600 * 1000);
+  EXPECT_EQ(EstimateClockSkew(long_overlap, long_overlap_input), 0);
+
+  const int64_t skew_ms = EstimateClockSkew(activities[0].records, activities[1].records);
+  EXPECT_EQ(skew_ms, -5000);
+  ShiftActivity(activities[1], skew_ms);
+
+  MergePriorities priorities;
+  EXPECT_FALSE(ParseMergePriorities("power=3", 2u, priorities));
+  ASSERT_TRUE(ParseMergePriorities("heartrate=2", 2u, priorities));
+  const std::vector<FitData> merged = MergeRecords(activities, {0u, 120u}, priorities);
+  ASSERT_EQ(merged.size(), 120u);
+  EXPECT_EQ(merged[10].GetValue(DataType::kTypeTimeStamp), 10000);
+  EXPECT_EQ(merged[10].GetValue(DataType::kTypePower), 210);
+  EXPECT_EQ(merged[10].GetValue(DataType::kTypeHeartRate), activities[0].records[10].GetValue(DataType::kTypeHeartRate) + 1);
+}
+
+TEST(CompareActivity, DistanceIndex) {
+  // reference covers 4 m/s, the main ride 5 m/s and gets ahead of its end
+  std::vector<FitData> reference_records(20u);
+  std::vector<FitData> records(20u);
+  for (int64_t second = 0; second < 20; ++second) {
+    FitData& reference = reference_records[static_cast<size_t>(second)];
+    reference.MergeValue(DataType::kTypeTimeStamp, 1000000 + second * 1000);
+    reference.MergeValue(DataType::kTypeDistance, second * 400);
+    reference.MergeValue(DataType::kTypeSpeed, 4000);
+    FitData& record = records[static_cast<size_t>(second)];
+    record.MergeValue(DataType::kTypeTimeStamp, 2000000 + second * 1000);
+    record.MergeValue(DataType::kTypeDistance, second * 500);
+    record.MergeValue(DataType::kTypeSpeed, 5000);
+  }
+  // standing still in the reference does not break the index
+  reference_records[5].SetValue(DataType::kTypeDistance, 1600);
+
+  const DistanceIndex index(reference_records);
+  EXPECT_EQ(index.Size(), 19u);
+  int64_t elapsed_ms{0};
+  int64_t speed{0};
+  ASSERT_TRUE(index.Lookup(1000, elapsed_ms, speed));
+  EXPECT_EQ(elapsed_ms, 2500);
+  EXPECT_EQ(speed, 4000);
+  EXPECT_FALSE(index.Lookup(20000, elapsed_ms, speed));
+
+  CompareActivity(records, index, 0xFFFFFFFF);
+  EXPECT_EQ(records[2].GetValue(DataType::kTypeTimeDelta), -500);
+  EXPECT_EQ(records[2].GetValue(DataType::kTypeSpeedDelta), 1000);
+  EXPECT_EQ(records[19].GetTypes() & kDataTypeMasks[DataType::kTypeTimeDelta], 0u);
+}
+
+TEST(DeriveActivity, SpeedDistanceGrade) {
+  // north at 5 m/s climbing 0.2 m/s
+  constexpr double kSemicirclesPerMeter = 2147483648.0 / (std::numbers::pi * kEarthRadiusM);
+  std::vector<FitData> records(20u);
+  for (int64_t second = 0; second < 20; ++second) {
+    FitData& record = records[static_cast<size_t>(second)];
+    record.MergeValue(DataType::kTypeTimeStamp, second * 1000);
+    record.MergeValue(DataType::kTypeLatitude, std::llround(static_cast<double>(second) * 5.0 * kSemicirclesPerMeter));
+    record.MergeValue(DataType::kTypeLongitude, 0);
+    record.MergeValue(DataType::kTypeAltitude, 3000 + second);
+  }
+  DeriveActivity(records, 0xFFFFFFFF);
+  EXPECT_NEAR(static_cast<double>(records[10].GetValue(DataType::kTypeDistance)), 5000.0, 1.0);
+  EXPECT_NEAR(static_cast<double>(records[10].GetValue(DataType::kTypeSpeed)), 5000.0, 2.0);
+  EXPECT_NEAR(static_cast<double>(records[10].GetValue(DataType::kTypeGrade)), 400.0, 1.0);
+
+  // values of the device are not replaced
+  records[3].SetValue(DataType::kTypeSpeed, 1);
+  DeriveActivity(records, kDataTypeMasks[DataType::kTypeSpeed]);
+  EXPECT_EQ(records[3].GetValue(DataType::kTypeSpeed), 1);
+
+  // every entry point has the default of the command line, unknown names are not ignored
+  EXPECT_EQ(ConvertOptions{}.derive_data_types, kDataTypeMasks[DataType::kTypeSpeed] | kDataTypeMasks[DataType::kTypeDistance]);
+  uint32_t mask{1u};
+  EXPECT_TRUE(DeriveNamesToMask("none", mask));
+  EXPECT_EQ(mask, 0u);
+  EXPECT_TRUE(DeriveNamesToMask("grade,speed", mask));
+  EXPECT_EQ(mask, kDataTypeMasks[DataType::kTypeGrade] | kDataTypeMasks[DataType::kTypeSpeed]);
+  for (const std::string_view wrong : {"sped", "", "speed,", "power", "none,speed"}) {
+    EXPECT_FALSE(DeriveNamesToMask(wrong, mask)) << wrong;
+  }
+}
+
+TEST(RecordFilter, SegmentsOfMatchedRecords) {
+  // power efforts on a climb, one of them on the flat, and a fast descent with a record without speed
+  std::vector<FitData> records(600u);
+  for (int64_t second = 0; second < 600; ++second) {
+    FitData& record = records[static_cast<size_t>(second)];
+    record.MergeValue(DataType::kTypeTimeStamp, second * 1000);
+    const bool effort = (second >= 100 && second < 110) || (second >= 250 && second <= 260) || (second >= 300 && second < 305);
+    record.MergeValue(DataType::kTypePower, effort ? 450 : 200);
+    record.MergeValue(DataType::kTypeHeartRate, effort ? 170 : 120);
+    record.MergeValue(DataType::kTypeGrade, (second >= 300 && second < 305) ? 500 : 1000);
+    if (second != 405) {
+      record.MergeValue(DataType::kTypeSpeed, (second >= 400 && second < 410) ? 70 * 278 : 20 * 278);
+    }
+  }
+
+  FilterProgram program;
+  ASSERT_TRUE(FilterCompiler("power > 400 && grade > 8 || speed >= 70", false).Compile(program));
+  const std::vector<uint8_t> selection = SelectRecords(program, records);
+  const std::vector<std::pair<int64_t, int64_t>> expected = {{100000, 109000}, {250000, 260000}, {400000, 404000}, {406000, 409000}};
+  EXPECT_EQ(SelectedSegments(records, selection, 0, 0), expected);
+  const std::vector<std::pair<int64_t, int64_t>> padded = {{98000, 111000}, {248000, 262000}, {398000, 411000}};
+  EXPECT_EQ(SelectedSegments(records, selection, 2000, 0), padded);
+  EXPECT_EQ(SelectedSegments(records, selection, 0, 2000).size(), 3u);
+
+  ASSERT_TRUE(FilterCompiler("!(power <= 400) && (grade < 6)", false).Compile(program));
+  const std::vector<std::pair<int64_t, int64_t>> flat = {{300000, 304000}};
+  EXPECT_EQ(SelectedSegments(records, SelectRecords(program, records), 0, 0), flat);
+  // the short names of the cue template
+  ASSERT_TRUE(FilterCompiler("hr > 150 && grade > 8", false).Compile(program));
+  const std::vector<std::pair<int64_t, int64_t>> climbs = {{100000, 109000}, {250000, 260000}};
+  EXPECT_EQ(SelectedSegments(records, SelectRecords(program, records), 0, 0), climbs);
+  EXPECT_TRUE(FilterCompiler("alt > 100 || temp < 5 || dist >= 1", false).Compile(program));
+
+  for (const std::string_view wrong : {"power >", "speed > 1 &&", "latitude > 1", "(power > 1", "power > 1 )", "power = 1"}) {
+    EXPECT_FALSE(FilterCompiler(wrong, false).Compile(program)) << wrong;
+  }
+}
+
+TEST(DemTiles, BilinearFromMappedTile) {
+  // 3 arc second tile where elevation grows by 1 m per sample to the east and 2 m per sample to the south
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "fitconvert-dem-test";
+  std::filesystem::create_directories(directory);
+  {
+    std::vector<uint8_t> tile(1201u * 1201u * 2u);
+    for (size_t row = 0u; row < 1201u; ++row) {
+      for (size_t column = 0u; column < 1201u; ++column) {
+        const int16_t value = (row == 0u && column == 1200u) ? int16_t{-32768} : static_cast<int16_t>(column + row * 2u);
+        tile[(row * 1201u + column) * 2u] = static_cast<uint8_t>(static_cast<uint16_t>(value) >> 8);
+        tile[(row * 1201u + column) * 2u + 1u] = static_cast<uint8_t>(value & 0xFF);
+      }
+    }
+    std::ofstream(directory / "N45E006.hgt", std::ios::binary).write(reinterpret_cast<const char*>(tile.data()), tile.size());
+  }
+
+  DemTiles dem(directory, 1u);
+  constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+  constexpr double kInfinity = std::numeric_limits<double>::infinity();
+  const std::array<double, 7> latitudes = {45.5, 46.0 - 0.5 / 1200.0, 47.5, 45.9999, kNaN, 45.5, 1e300};
+  const std::array<double, 7> longitudes = {6.5, 6.0 + 0.25 / 1200.0, 6.5, 6.9999, 6.5, -kInfinity, 6.5};
+  std::array<double, 7> elevations;
+  dem.Elevations(latitudes.data(), longitudes.data(), latitudes.size(), elevations.data());
+  EXPECT_NEAR(elevations[0], 600.0 + 1200.0, 1e-6);
+  EXPECT_NEAR(elevations[1], 0.25 + 1.0, 1e-6);
+  // no tile, void corner, no position
+  for (size_t index = 2u; index < elevations.size(); ++index) {
+    EXPECT_TRUE(std::isnan(elevations[index])) << index;
+  }
+  EXPECT_EQ(dem.GetCachedTiles(), 1u);
+  std::filesystem::remove_all(directory);
+}
+
+TEST(RecordColumns, DecodedByType) {
+  const std::vector<uint8_t> file = MakeFitFile(1000u, 30u);
+  DataSourceMemory data_source(file.data(), file.size());
+  RecordColumns columns;
+  ASSERT_TRUE(DecodeColumns(data_source, 0xFFFFFFFF, false, columns));
+  ASSERT_EQ(columns.timestamps.size(), 30u);
+  EXPECT_EQ(columns.timestamps.front(), 1000000);
+  EXPECT_EQ(columns.timestamps.back(), 1029000);
+  // only the types the records have
+  ASSERT_EQ(columns.columns.size(), 1u);
+  EXPECT_EQ(columns.columns.front().first, "heartrate");
+  EXPECT_DOUBLE_EQ(columns.columns.front().second.front(), 100.0);
+  EXPECT_DOUBLE_EQ(columns.columns.front().second.back(), 129.0);
+
+  const std::vector<uint8_t> broken(file.begin(), file.end() - 1);
+  DataSourceMemory broken_source(broken.data(), broken.size());
+  EXPECT_FALSE(DecodeColumns(broken_source, 0xFFFFFFFF, false, columns));
+}
+
+TEST(CApi, WarmConverter) {
+  const std::vector<uint8_t> file = MakeFitFile(1000u, 30u);
+  const auto expected = Convert(std::make_unique<DataSourceMemory>(file.data(), file.size()), kOutputJsonTag, 500, 3u, 0xFFFFFFFF, false);
+  const std::string_view expected_json(expected->second.GetString(), expected->second.GetSize());
+
+  fitconvert_converter* converter = fitconvert_create();
+  ASSERT_NE(converter, nullptr);
+  EXPECT_EQ(fitconvert_abi_version(), static_cast<uint32_t>(FITCONVERT_ABI_VERSION));
+  EXPECT_EQ(fitconvert_set_option(converter, "type", "json"), FITCONVERT_OK);
+  EXPECT_EQ(fitconvert_set_option(converter, "offset", "500"), FITCONVERT_OK);
+  EXPECT_EQ(fitconvert_set_option(converter, "smoothness", "3"), FITCONVERT_OK);
+  EXPECT_EQ(fitconvert_set_option(converter, "smoothness", "6"), FITCONVERT_ERROR_ARGUMENT);
+  EXPECT_EQ(fitconvert_set_option(converter, "type", "srt"), FITCONVERT_ERROR_ARGUMENT);
+  EXPECT_EQ(fitconvert_set_option(converter, "color", "red"), FITCONVERT_ERROR_ARGUMENT);
+  EXPECT_EQ(fitconvert_set_option(converter, "derive", "sped"), FITCONVERT_ERROR_ARGUMENT);
+
+  const uint8_t* data_ptr{nullptr};
+  size_t size{0u};
+  EXPECT_EQ(fitconvert_output(converter, &data_ptr, &size), FITCONVERT_ERROR_ARGUMENT);
+
+  // fed by parts, then the same converter again with the input filled in place
+  for (size_t run = 0u; run < 2u; ++run) {
+    if (run == 0u) {
+      EXPECT_EQ(fitconvert_feed(converter, file.data(), 100u), FITCONVERT_OK);
+      EXPECT_EQ(fitconvert_feed(converter, file.data() + 100u, file.size() - 100u), FITCONVERT_OK);
+    } else {
+      fitconvert_reset(converter);
+      uint8_t* buffer_ptr = fitconvert_feed_buffer(converter, file.size());
+      ASSERT_NE(buffer_ptr, nullptr);
+      std::copy(file.begin(), file.end(), buffer_ptr);
+    }
+    ASSERT_EQ(fitconvert_convert(converter), FITCONVERT_OK);
+    ASSERT_EQ(fitconvert_output(converter, &data_ptr, &size), FITCONVERT_OK);
+    EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(data_ptr), size), expected_json);
+  }
+
+  fitconvert_reset(converter);
+  EXPECT_EQ(fitconvert_feed(converter, file.data(), file.size() - 1u), FITCONVERT_OK);
+  EXPECT_EQ(fitconvert_convert(converter), FITCONVERT_ERROR_DECODE);
+  EXPECT_EQ(fitconvert_output(converter, &data_ptr, &size), FITCONVERT_ERROR_ARGUMENT);
+  fitconvert_destroy(converter);
+}
+
+TEST(Kernels, EveryIsaMatchesScalar) {
+  const Kernels& scalar = KernelsFor(Isa::kScalar);
+  ASSERT_EQ(scalar.isa, Isa::kScalar);
+  // odd sizes for the tails, NaN and values equal to the threshold
+  constexpr size_t kValues = 203u;
+  std::vector<double> values(kValues);
+  std::vector<uint8_t> present(kValues);
+  for (size_t index = 0u; index < kValues; ++index) {
+    values[index] = index % 13u == 0u ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(index % 7u);
+    present[index] = index % 5u != 0u;
+  }
+
+  for (const Isa isa : SupportedIsas()) {
+    const Kernels& kernels = KernelsFor(isa);
+    EXPECT_EQ(kernels.isa, isa) << IsaName(isa);
+    for (const size_t count : {size_t{0u}, size_t{7u}, size_t{64u}, kValues}) {
+      for (size_t op = 0u; op < kCompareOps; ++op) {
+        std::vector<uint8_t> expected(count + 1u, 0xAAu);
+        std::vector<uint8_t> actual(count + 1u, 0xAAu);
+        scalar.compare[op](values.data(), present.data(), count, 3.0, expected.data());
+        kernels.compare[op](values.data(), present.data(), count, 3.0, actual.data());
+        EXPECT_EQ(actual, expected) << IsaName(isa) << " op " << op << " count " << count;
+      }
+
+      std::vector<uint8_t> expected(present.begin(), present.begin() + count);
+      std::vector<uint8_t> actual(expected);
+      scalar.compare[static_cast<size_t>(CompareOp::kGreater)](values.data(), present.data(), count, 2.0, expected.data());
+      kernels.compare[static_cast<size_t>(CompareOp::kGreater)](values.data(), present.data(), count, 2.0, actual.data());
+      std::vector<uint8_t> right(count);
+      scalar.compare[static_cast<size_t>(CompareOp::kNotEqual)](values.data(), present.data(), count, 4.0, right.data());
+      scalar.mask_and(expected.data(), right.data(), count);
+      kernels.mask_and(actual.data(), right.data(), count);
+      EXPECT_EQ(actual, expected) << IsaName(isa) << " and";
+      scalar.mask_not(expected.data(), count);
+      kernels.mask_not(actual.data(), count);
+      EXPECT_EQ(actual, expected) << IsaName(isa) << " not";
+      scalar.mask_or(expected.data(), right.data(), count);
+      kernels.mask_or(actual.data(), right.data(), count);
+      EXPECT_EQ(actual, expected) << IsaName(isa) << " or";
+    }
+  }
+}
+
+TEST(Kernels, FitCrcMatchesSdk) {
+  std::vector<uint8_t> data(1000u);
+  for (size_t index = 0u; index < data.size(); ++index) {
+    data[index] = static_cast<uint8_t>(index * 131u + 7u);
+  }
+  for (const size_t size : {size_t{0u}, size_t{1u}, size_t{7u}, size_t{8u}, size_t{15u}, data.size()}) {
+    EXPECT_EQ(FitCrc16(0x1234u, data.data(), size), FitCRC_Update16(0x1234u, data.data(), static_cast<FIT_UINT32>(size))) << size;
+  }
+}
+
+TEST(TrimFit, WindowWithCompressedTimestamps) {
+  // file id without a timestamp, 10 records with the timestamp field, 10 records with compressed timestamps
+  std::vector<uint8_t> data = {0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x04};
+  data.insert(data.end(), kRecordDefinition.begin(), kRecordDefinition.end());
+  AppendRecords(data, 1000u, 10u);
+  data.insert(data.end(), {0x41, 0x00, 0x00, 0x14, 0x00, 0x01, 0x03, 0x01, 0x02});
+  for (uint32_t timestamp = 1010u; timestamp < 1020u; ++timestamp) {
+    data.push_back(static_cast<uint8_t>(0x80u | (1u << 5u) | (timestamp & 0x1Fu)));
+    data.push_back(static_cast<uint8_t>(100u + timestamp - 1000u));
+  }
+  const std::vector<uint8_t> file = WrapFitFile(data);
+
+  auto trim = [&file](const int64_t from_ms, const int64_t to_ms) {
+    DataSourceMemory input(file.data(), file.size());
+    const std::unique_ptr<FitResult> result = TrimFit(input, from_ms, to_ms, false);
+    EXPECT_EQ(result->first, ParseResult::kSuccess);
+    const uint8_t* trimmed_ptr = reinterpret_cast<const uint8_t*>(result->second.GetString());
+    const size_t trimmed_size = result->second.GetSize();
+    EXPECT_EQ(FitCRC_Calc16(trimmed_ptr, static_cast<FIT_UINT32>(trimmed_size)), 0u);
+    DataSourceMemory output(trimmed_ptr, trimmed_size);
+    auto [status, activity] = DecodeSource(output, 0xFFFFFFFF);
+    EXPECT_EQ(status, FIT_CONVERT_END_OF_FILE);
+    return std::make_pair(trimmed_size, std::move(activity.records));
+  };
+
+  const auto [size, records] = trim(12000, 15000);
+  ASSERT_EQ(records.size(), 4u);
+  for (size_t index = 0u; index < records.size(); ++index) {
+    EXPECT_EQ(records[index].GetValue(DataType::kTypeTimeStamp), (1012 + static_cast<int64_t>(index)) * 1000);
+    EXPECT_EQ(records[index].GetValue(DataType::kTypeHeartRate), 112 + static_cast<int64_t>(index));
+  }
+  // header, file id, the first compressed record with the timestamp field and its definition again for the rest, crc
+  EXPECT_EQ(size, 14u + 11u + (12u + 6u) + 9u + 3u * 2u + 2u);
+
+  const auto [whole_size, whole_records] = trim(0, -1);
+  EXPECT_EQ(whole_size, file.size());
+  EXPECT_EQ(whole_records.size(), 20u);
+  EXPECT_EQ(whole_records.back().GetValue(DataType::kTypeTimeStamp), 1019000);
+
+  const auto [head_size, head_records] = trim(0, 4000);
+  ASSERT_EQ(head_records.size(), 5u);
+  EXPECT_EQ(head_records.back().GetValue(DataType::kTypeTimeStamp), 1004000);
+}
+
+TEST(TrimFit, CompactIsLossless) {
+  // a definition before every record and a manufacturer message with a timestamp that the profile has not
+  std::vector<uint8_t> data;
+  for (const uint32_t timestamp : {1000u, 1001u, 1002u, 1011u, 1043u, 1044u}) {
+    if (timestamp == 1011u) {
+      data.insert(data.end(), {0x41, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x04, 0x86, 0x01, 0xF2, 0x03, 0x00, 0x00});
+    }
+    data.insert(data.end(), kRecordDefinition.begin(), kRecordDefinition.end());
+    AppendRecords(data, timestamp, 1u);
+  }
+  const std::vector<uint8_t> file = WrapFitFile(data);
+  std::vector<uint8_t> chained(file);
+  chained.insert(chained.end(), file.begin(), file.end());
+
+  DataSourceMemory input(chained.data(), chained.size());
+  const std::unique_ptr<FitResult> result = TrimFit(input, 0, -1, true);
+  ASSERT_EQ(result->first, ParseResult::kSuccess);
+  const uint8_t* compact_ptr = reinterpret_cast<const uint8_t*>(result->second.GetString());
+  // header, record definition and record, compressed definition and two records, manufacturer definition and message,
+  // records after it and after 32 s with the timestamp field, compressed record, crc
+  constexpr size_t kCompactFileSize = 14u + (12u + 6u) + (9u + 2u * 2u) + (9u + 5u) + 6u + 6u + 2u + 2u;
+  ASSERT_EQ(result->second.GetSize(), kCompactFileSize * 2u);
+  EXPECT_EQ(FitCRC_Calc16(compact_ptr, kCompactFileSize), 0u);
+  EXPECT_EQ(FindChainedFiles(compact_ptr, result->second.GetSize()).size(), 2u);
+
+  auto json = [](const uint8_t* data_ptr, const size_t size) {
+    const auto converted = Convert(std::make_unique<DataSourceMemory>(data_ptr, size), kOutputJsonTag, 0, 0u, 0xFFFFFFFF, false);
+    EXPECT_EQ(converted->first, ParseResult::kSuccess);
+    return std::string(converted->second.GetString(), converted->second.GetSize());
+  };
+  EXPECT_EQ(json(compact_ptr, result->second.GetSize()), json(chained.data(), chained.size()));
+}
+
+TEST(SpatialIndex, BuildAndQuery) {
+  auto point = [](const double latitude, const double longitude, const uint32_t timestamp) {
+    return TrackPoint{static_cast<int32_t>(latitude / 180.0 * 2147483648.0), static_cast<int32_t>(longitude / 180.0 * 2147483648.0), timestamp};
+  };
+  // "b" passes the place once, "a" goes out and back after a stop, "c" is far away
+  std::vector<TrackPoint> out_and_back;
+  std::vector<TrackPoint> one_way;
+  for (uint32_t index = 0u; index <= 50u; ++index) {
+    out_and_back.push_back(point(45.0, 6.0 + index * 0.0002, 1000u + index));
+    one_way.push_back(point(45.0, 6.0 + index * 0.0002, 5000u + index));
+  }
+  for (uint32_t index = 0u; index < 50u; ++index) {
+    // standing at the turn point is not stored
+    out_and_back.push_back(point(45.0, 6.01 - (index < 10u ? 0.0 : (index - 9u) * 0.0002), 1600u + index));
+  }
+  SpatialIndexBuilder builder;
+  builder.AddTrack("b.fit", one_way);
+  builder.AddTrack("c.fit", {point(50.0, 6.0, 100u), point(50.001, 6.0, 110u)});
+  builder.AddTrack("a.fit", out_and_back);
+  const std::filesystem::path path = std::filesystem::temp_directory_path() / "fitconvert-index-test.idx";
+  builder.Write(path);
+
+  {
+    const SpatialIndex index(path);
+    EXPECT_EQ(index.GetTracks(), 3u);
+    const std::vector<TrackPass> passes = index.Query(45.0, 6.005, 30.0);
+    ASSERT_EQ(passes.size(), 3u);
+    EXPECT_EQ(passes[0].name, "a.fit");
+    EXPECT_EQ(passes[0].timestamp, 1025u);
+    EXPECT_EQ(passes[0].offset, 25000);
+    EXPECT_EQ(passes[1].name, "a.fit");
+    EXPECT_EQ(passes[1].timestamp, 1600u + 34u);
+    EXPECT_EQ(passes[1].offset, 634000);
+    EXPECT_EQ(passes[2].name, "b.fit");
+    EXPECT_EQ(passes[2].offset, 25000);
+    for (const TrackPass& pass : passes) {
+      EXPECT_LT(pass.distance, 1.0);
+    }
+    EXPECT_TRUE(index.Query(45.001, 6.005, 30.0).empty());
+    // the box of a large radius has more cells than the index, the stored cells are scanned instead
+    const std::vector<TrackPass> far_passes = index.Query(47.5, 6.0, 300000.0);
+    ASSERT_EQ(far_passes.size(), 4u);
+    EXPECT_EQ(far_passes[3].name, "c.fit");
+    EXPECT_EQ(index.Query(0.0, -179.9, 20000000.0).size(), 4u);
+    EXPECT_TRUE(index.Query(0.0, 0.0, std::numeric_limits<double>::quiet_NaN()).empty());
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(Batch, ShardsSplitTheDirectory) {
+  Shard shard;
+  EXPECT_TRUE(ParseShard("2/4", shard));
+  EXPECT_EQ(shard.index, 2u);
+  EXPECT_EQ(shard.count, 4u);
+  for (const char* text : {"0/4", "5/4", "1/0", "1", "1/4x", "/4", "a/b"}) {
+    EXPECT_FALSE(ParseShard(text, shard)) << text;
+  }
+  // FNV-1a of "2024/ride.fit" is 0x4C50EC28B137ECD1, shards do not depend on the platform separators
+  EXPECT_EQ(ShardOf(std::filesystem::path("2024") / "ride.fit", 1000u), 930u);
+
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "fitconvert-batch-test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory / "input" / "2024");
+  const std::vector<uint8_t> file = MakeFitFile(1000u, 3u);
+  for (const char* name : {"a.fit", "b.fit", "c.fit", "2024/d.fit", "2024/e.FIT", "2024/f.fit", "2024/g.fit", "notes.txt"}) {
+    std::ofstream(directory / "input" / name, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), file.size());
+  }
+  std::mutex converted_mutex;
+  std::vector<std::filesystem::path> converted;
+  auto convert = [&](const std::filesystem::path& fit_file, const std::filesystem::path& output_file) {
+    WriteFileAtomically(std::filesystem::path(output_file).replace_extension("vtt"), "WEBVTT", 6u);
+    const std::lock_guard<std::mutex> lock(converted_mutex);
+    converted.push_back(fit_file.lexically_relative(directory / "input"));
+    return fit_file.filename() != "f.fit";
+  };
+  const bool first = ConvertBatch(directory / "input", directory / "output", {"vtt"}, Shard{1u, 2u}, 2u, false, convert);
+  const bool second = ConvertBatch(directory / "input", directory / "output", {"vtt"}, Shard{2u, 2u}, 2u, false, convert);
+  // only the shard of the failed file is failed
+  const size_t failed_shard = ShardOf(std::filesystem::path("2024") / "f.fit", 2u);
+  EXPECT_EQ(first, failed_shard != 1u);
+  EXPECT_EQ(second, failed_shard != 2u);
+
+  // every file is converted once by one of the shards
+  std::sort(converted.begin(), converted.end());
+  const std::vector<std::filesystem::path> expected = {"2024/d.fit", "2024/e.FIT", "2024/f.fit", "2024/g.fit", "a.fit", "b.fit", "c.fit"};
+  EXPECT_EQ(converted, expected);
+  EXPECT_TRUE(std::filesystem::exists(directory / "output" / "2024" / "e.vtt"));
+
+  size_t manifest_files{0u};
+  for (const size_t index : {1u, 2u}) {
+    std::ifstream manifest_stream(directory / "output" / ("shard-" + std::to_string(index) + "-of-2.json"));
+    const std::string manifest((std::istreambuf_iterator<char>(manifest_stream)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(manifest.find(R"({"shard":)" + std::to_string(index) + R"(,"shards":2,"files":[)"), 0u);
+    for (size_t position = manifest.find(R"("input":)"); position != std::string::npos; position = manifest.find(R"("input":)", position + 1u)) {
+      ++manifest_files;
+    }
+    EXPECT_EQ(manifest.find(R"({"input":"2024/f.fit","outputs":["2024/f.vtt"],"converted":false})") != std::string::npos,
+              index == failed_shard);
+  }
+  EXPECT_EQ(manifest_files, 7u);
+  std::filesystem::remove_all(directory);
+}
+
+TEST(Batch, ResumedByJournal) {
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "fitconvert-journal-test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  const std::vector<uint8_t> file = MakeFitFile(1000u, 3u);
+  for (const char* name : {"a.fit", "b.fit", "c.fit"}) {
+    std::ofstream(directory / name, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), file.size());
+  }
+  std::vector<std::string> converted;
+  auto convert = [&](const std::filesystem::path& fit_file, const std::filesystem::path& output_file) {
+    WriteFileAtomically(std::filesystem::path(output_file).replace_extension("vtt"), "WEBVTT", 6u);
+    converted.push_back(fit_file.filename().string());
+    return true;
+  };
+  auto read_journal = [&directory]() {
+    std::ifstream journal_stream(directory / "shard-1-of-1.journal");
+    return std::string((std::istreambuf_iterator<char>(journal_stream)), std::istreambuf_iterator<char>());
+  };
+
+  EXPECT_TRUE(ConvertBatch(directory, directory, {"vtt"}, Shard{}, 1u, true, convert));
+  EXPECT_EQ(converted.size(), 3u);
+  const std::string journal = read_journal();
+  EXPECT_EQ(std::count(journal.begin(), journal.end(), '\n'), 3);
+  // FNV-1a of the output "WEBVTT"
+  EXPECT_NE(journal.find("a.fit\t" + std::to_string(file.size()) + "\t"), std::string::npos);
+  EXPECT_NE(journal.find("\t4cda2567c00a75d5\t"), std::string::npos);
+
+  // the last line (of c.fit by one worker) is cut by a crash, it and a changed file are converted again
+  {
+    std::ofstream journal_stream(directory / "shard-1-of-1.journal", std::ios::binary | std::ios::trunc);
+    journal_stream << journal.substr(0u, journal.rfind('\t'));
+  }
+  std::ofstream(directory / "b.fit", std::ios::binary | std::ios::app).put(0);
+  converted.clear();
+  EXPECT_TRUE(ConvertBatch(directory, directory, {"vtt"}, Shard{}, 1u, true, convert));
+  EXPECT_EQ(converted, (std::vector<std::string>{"b.fit", "c.fit"}));
+
+  converted.clear();
+  EXPECT_TRUE(ConvertBatch(directory, directory, {"vtt"}, Shard{}, 1u, true, convert));
+  EXPECT_TRUE(converted.empty());
+  // an output that is lost or changed after the journal line is converted again
+  std::filesystem::remove(directory / "a.vtt");
+  std::ofstream(directory / "c.vtt", std::ios::binary | std::ios::app).put('\n');
+  EXPECT_TRUE(ConvertBatch(directory, directory, {"vtt"}, Shard{}, 1u, true, convert));
+  EXPECT_EQ(converted, (std::vector<std::string>{"a.fit", "c.fit"}));
+  converted.clear();
+  EXPECT_TRUE(ConvertBatch(directory, directory, {"vtt"}, Shard{}, 1u, false, convert));
+  EXPECT_EQ(converted.size(), 3u);
+  const std::string restarted_journal = read_journal();
+  EXPECT_EQ(std::count(restarted_journal.begin(), restarted_journal.end(), '\n'), 3);
+  std::filesystem::remove_all(directory);
+}
+
+#ifdef __linux__
+TEST(WatchDirectory, ConvertsWrittenFitFiles) {
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "fitconvert-watch-test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  std::atomic<bool> stop{false};
+  std::mutex converted_mutex;
+  std::vector<std::string> converted;
+  auto convert = [&](const std::filesystem::path& fit_file) {
+    WriteFileAtomically(std::filesystem::path(fit_file).replace_extension(".vtt"), "WEBVTT", 6u);
+    const std::lock_guard<std::mutex> lock(converted_mutex);
+    converted.push_back(fit_file.filename().string());
+  };
+  bool watched{false};
+  std::thread watcher([&]() { watched = WatchDirectory(directory, 2u, 200, stop, convert); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const std::vector<uint8_t> file = MakeFitFile(1000u, 3u);
+  // written in two parts within the debounce time
+  std::ofstream(directory / "ride.fit", std::ios::binary).write(reinterpret_cast<const char*>(file.data()), 10);
+  std::ofstream(directory / "ride.fit", std::ios::binary | std::ios::app)
+      .write(reinterpret_cast<const char*>(file.data()) + 10, static_cast<std::streamsize>(file.size() - 10u));
+  std::ofstream(directory / "clip.mp4", std::ios::binary).write("mp4", 3);
+  std::ofstream(directory / "RUN.FIT", std::ios::binary).write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  auto converted_count = [&]() {
+    const std::lock_guard<std::mutex> lock(converted_mutex);
+    return converted.size();
+  };
+  while (converted_count() < 2u && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  stop = true;
+  watcher.join();
+  EXPECT_TRUE(watched);
+
+  std::sort(converted.begin(), converted.end());
+  EXPECT_EQ(converted, (std::vector<std::string>{"RUN.FIT", "ride.fit"}));
+  EXPECT_TRUE(std::filesystem::exists(directory / "ride.vtt"));
+  EXPECT_TRUE(std::filesystem::exists(directory / "RUN.vtt"));
+  // no temporary files are left
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator()), 5);
+  std::filesystem::remove_all(directory);
+}
+#endif
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
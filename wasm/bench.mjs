@@ -0,0 +1,46 @@
+// node wasm/bench.mjs [file.fit], without a file a generated one of 100000 records is used, FITCONVERT_WASM is the path of
+// the emscripten module (fitconvert-wasm.mjs)
+
+import fs from 'node:fs';
+import path from 'node:path';
+import { performance } from 'node:perf_hooks';
+import { pathToFileURL } from 'node:url';
+
+import { loadFitconvert } from './fitconvert.mjs';
+import { makeFitFile } from './fitfile.mjs';
+
+const modulePath = process.env.FITCONVERT_WASM ?? path.join(import.meta.dirname, '..', 'build-wasm', 'fitconvert-wasm.mjs');
+const { default: createModule } = await import(pathToFileURL(modulePath).href);
+const fitconvert = await loadFitconvert(createModule);
+
+// the file is read into the heap, not copied there
+const fitPath = process.argv[2];
+let input;
+if (fitPath) {
+  const size = fs.statSync(fitPath).size;
+  input = fitconvert.input(size);
+  const fd = fs.openSync(fitPath, 'r');
+  fs.readSync(fd, input.view, 0, size, 0);
+  fs.closeSync(fd);
+} else {
+  const file = makeFitFile(1000000000, 100000);
+  input = fitconvert.input(file.length);
+  input.view.set(file);
+}
+
+console.log(`isa: ${fitconvert.isa}, input: ${input.size} bytes`);
+for (const type of ['vtt', 'json']) {
+  // warm up
+  fitconvert.convert(input, { type }).free();
+  const iterations = 20;
+  let outputSize = 0;
+  const start = performance.now();
+  for (let iteration = 0; iteration < iterations; ++iteration) {
+    const output = fitconvert.convert(input, { type });
+    outputSize = output.bytes.length;
+    output.free();
+  }
+  const milliseconds = (performance.now() - start) / iterations;
+  console.log(`${type}: ${milliseconds.toFixed(2)} ms, ${(input.size / 1024 / 1024 / (milliseconds / 1000)).toFixed(1)} MB/s of .fit, ${outputSize} bytes`);
+}
+input.free();
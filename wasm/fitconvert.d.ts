@@ -0,0 +1,38 @@
+// Types of the JavaScript binding of the fitconvert WebAssembly module.
+
+export type OutputType = 'vtt' | 'json';
+
+export interface ConvertOptions {
+  type?: OutputType;
+  // milliseconds, positive moves the telemetry earlier
+  offset?: number;
+  // 0 to 5
+  smoothness?: number;
+  // mask of the data types, all by default
+  datatypes?: number;
+  imperial?: boolean;
+}
+
+// buffer in the wasm heap the .fit file is read into
+export declare class FitInput {
+  readonly pointer: number;
+  readonly size: number;
+  readonly view: Uint8Array;
+  free(): void;
+}
+
+export declare class FitOutput {
+  readonly ok: boolean;
+  // view of the output in the wasm heap, valid until free() or the next call into the module
+  readonly bytes: Uint8Array;
+  text(): string;
+  free(): void;
+}
+
+export declare class Fitconvert {
+  input(size: number): FitInput;
+  convert(input: FitInput, options?: ConvertOptions): FitOutput;
+  readonly isa: string;
+}
+
+export declare function loadFitconvert(createModule: (options?: object) => Promise<unknown>, options?: object): Promise<Fitconvert>;
@@ -0,0 +1,90 @@
+// JavaScript binding of the fitconvert WebAssembly module.
+//
+// The .fit file is read straight into the wasm heap through FitInput.view and the result is a Uint8Array view of the
+// output buffer in the heap, nothing is copied or marshalled as strings on the way in or out.
+
+const kTypes = ['vtt', 'json'];
+
+// memory can grow on every call into the module, views are taken from the current heap when they are asked for
+export class FitInput {
+  constructor(module, pointer, size) {
+    this.module = module;
+    this.pointer = pointer;
+    this.size = size;
+  }
+
+  get view() {
+    return this.module.HEAPU8.subarray(this.pointer, this.pointer + this.size);
+  }
+
+  free() {
+    if (this.pointer) {
+      this.module._fitconvert_input_free(this.pointer);
+      this.pointer = 0;
+    }
+  }
+}
+
+export class FitOutput {
+  constructor(module, pointer) {
+    this.module = module;
+    this.pointer = pointer;
+  }
+
+  get ok() {
+    return this.module._fitconvert_result_status(this.pointer) === 0;
+  }
+
+  // valid until free() or the next call into the module
+  get bytes() {
+    const data = this.module._fitconvert_result_data(this.pointer);
+    return this.module.HEAPU8.subarray(data, data + this.module._fitconvert_result_size(this.pointer));
+  }
+
+  text() {
+    return new TextDecoder().decode(this.bytes);
+  }
+
+  free() {
+    if (this.pointer) {
+      this.module._fitconvert_result_free(this.pointer);
+      this.pointer = 0;
+    }
+  }
+}
+
+export class Fitconvert {
+  constructor(module) {
+    this.module = module;
+  }
+
+  // heap buffer for a .fit file of size bytes
+  input(size) {
+    const pointer = this.module._fitconvert_input(size);
+    if (!pointer) {
+      throw new RangeError(`no memory for ${size} bytes of .fit file`);
+    }
+    return new FitInput(this.module, pointer, size);
+  }
+
+  convert(input, { type = 'vtt', offset = 0, smoothness = 0, datatypes = 0xffffffff, imperial = false } = {}) {
+    const typeIndex = kTypes.indexOf(type);
+    if (typeIndex < 0) {
+      throw new TypeError(`unknown type format '${type}', only 'vtt' or 'json' is supported`);
+    }
+    const pointer = this.module._fitconvert_convert(input.pointer, input.size, typeIndex, offset, smoothness, datatypes >>> 0, imperial ? 1 : 0);
+    return new FitOutput(this.module, pointer);
+  }
+
+  // instruction set of the kernels, simd128 when the module is built with it
+  get isa() {
+    const heap = this.module.HEAPU8;
+    const name = this.module._fitconvert_isa();
+    return new TextDecoder().decode(heap.subarray(name, heap.indexOf(0, name)));
+  }
+}
+
+// createModule is the factory of the emscripten build, e.g. `import createModule from './fitconvert-wasm.mjs'`
+export async function loadFitconvert(createModule, options = {}) {
+  return new Fitconvert(await createModule(options));
+}
@@ -0,0 +1,99 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// C interface of the WebAssembly module: the .fit file is read into the wasm heap and the result is read from it, nothing
+// is copied or converted to strings between JavaScript and the module
+
+#include <emscripten/emscripten.h>
+#include <spdlog/spdlog.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string_view>
+
+#include "../datasource.h"
+#include "../kernels.h"
+#include "../parser.h"
+
+namespace {
+
+// same order as the types of the JavaScript binding
+constexpr std::string_view kOutputTypes[] = {kOutputVttTag, kOutputJsonTag};
+
+// the console of the page gets errors only, not the statistics of every conversion
+[[maybe_unused]] const bool kQuietLog = [] {
+  spdlog::set_level(spdlog::level::err);
+  return true;
+}();
+
+}  // namespace
+
+extern "C" {
+
+// buffer in the heap for the .fit file, JavaScript reads the file into a view of it
+EMSCRIPTEN_KEEPALIVE uint8_t* fitconvert_input(const size_t size) {
+  return static_cast<uint8_t*>(std::malloc(size));
+}
+
+EMSCRIPTEN_KEEPALIVE void fitconvert_input_free(uint8_t* input_ptr) {
+  std::free(input_ptr);
+}
+
+// the input is used in place, the result keeps the output buffer until fitconvert_result_free, offset is in milliseconds
+EMSCRIPTEN_KEEPALIVE FitResult* fitconvert_convert(const uint8_t* input_ptr,
+                                                   const size_t size,
+                                                   const uint32_t type,
+                                                   const double offset,
+                                                   const uint32_t smoothness,
+                                                   const uint32_t datatypes,
+                                                   const uint32_t imperial) {
+  if (type >= std::size(kOutputTypes)) {
+    return nullptr;
+  }
+  return Convert(std::make_unique<DataSourceMemory>(input_ptr, size), kOutputTypes[type], static_cast<int64_t>(offset),
+                 static_cast<uint8_t>(smoothness), datatypes, imperial != 0u)
+      .release();
+}
+
+// 0 on success
+EMSCRIPTEN_KEEPALIVE uint32_t fitconvert_result_status(const FitResult* result_ptr) {
+  return static_cast<uint32_t>(result_ptr->first);
+}
+
+EMSCRIPTEN_KEEPALIVE const char* fitconvert_result_data(const FitResult* result_ptr) {
+  return result_ptr->second.GetString();
+}
+
+EMSCRIPTEN_KEEPALIVE size_t fitconvert_result_size(const FitResult* result_ptr) {
+  return result_ptr->second.GetSize();
+}
+
+EMSCRIPTEN_KEEPALIVE void fitconvert_result_free(FitResult* result_ptr) {
+  delete result_ptr;
+}
+
+// instruction set of the kernels, a zero terminated name
+EMSCRIPTEN_KEEPALIVE const char* fitconvert_isa() {
+  return IsaName(ActiveKernels().isa).data();
+}
+}
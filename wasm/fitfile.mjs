@@ -0,0 +1,36 @@
+// Minimal .fit files for the tests and the benchmark: records of timestamp and heart rate, the same as in tests.cpp.
+
+const kCrcTable = [0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401, 0xa001, 0x6c00, 0x7800, 0xb401, 0x5000, 0x9c01, 0x8801, 0x4400];
+
+function crc16(bytes, crc = 0) {
+  for (const byte of bytes) {
+    let tmp = kCrcTable[crc & 0xf];
+    crc = ((crc >> 4) & 0x0fff) ^ tmp ^ kCrcTable[byte & 0xf];
+    tmp = kCrcTable[crc & 0xf];
+    crc = ((crc >> 4) & 0x0fff) ^ tmp ^ kCrcTable[(byte >> 4) & 0xf];
+  }
+  return crc;
+}
+
+// record definition of timestamp and heart rate
+const kRecordDefinition = [0x40, 0x00, 0x00, 0x14, 0x00, 0x02, 0xfd, 0x04, 0x86, 0x03, 0x01, 0x02];
+const kRecordSize = 6;
+const kHeaderSize = 14;
+
+export function makeFitFile(timestamp, records) {
+  const dataSize = kRecordDefinition.length + records * kRecordSize;
+  const file = new Uint8Array(kHeaderSize + dataSize + 2);
+  const view = new DataView(file.buffer);
+  file.set([kHeaderSize, 0x20, 0x77, 0x08]);
+  view.setUint32(4, dataSize, true);
+  file.set([0x2e, 0x46, 0x49, 0x54], 8);
+  view.setUint16(12, crc16(file.subarray(0, 12)), true);
+  file.set(kRecordDefinition, kHeaderSize);
+  for (let index = 0, position = kHeaderSize + kRecordDefinition.length; index < records; ++index, position += kRecordSize) {
+    file[position] = 0x00;
+    view.setUint32(position + 1, timestamp + index, true);
+    file[position + 5] = 100 + (index % 100);
+  }
+  view.setUint16(file.length - 2, crc16(file.subarray(0, file.length - 2)), true);
+  return file;
+}
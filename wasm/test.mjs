@@ -0,0 +1,72 @@
+// node --test wasm/test.mjs, FITCONVERT_WASM is the path of the emscripten module (fitconvert-wasm.mjs)
+
+import assert from 'node:assert/strict';
+import path from 'node:path';
+import { test } from 'node:test';
+import { pathToFileURL } from 'node:url';
+
+import { loadFitconvert } from './fitconvert.mjs';
+import { makeFitFile } from './fitfile.mjs';
+
+const modulePath = process.env.FITCONVERT_WASM ?? path.join(import.meta.dirname, '..', 'build-wasm', 'fitconvert-wasm.mjs');
+const { default: createModule } = await import(pathToFileURL(modulePath).href);
+const fitconvert = await loadFitconvert(createModule);
+
+function convertFile(file, options) {
+  const input = fitconvert.input(file.length);
+  input.view.set(file);
+  const output = fitconvert.convert(input, options);
+  try {
+    assert.ok(output.ok);
+    return output.text();
+  } finally {
+    output.free();
+    input.free();
+  }
+}
+
+test('simd kernels are built in', () => {
+  assert.equal(fitconvert.isa, 'simd128');
+});
+
+test('vtt of records', () => {
+  const vtt = convertFile(makeFitFile(1000, 30), { type: 'vtt' });
+  assert.ok(vtt.startsWith('WEBVTT'));
+  assert.match(vtt, /100❤️/);
+  assert.match(vtt, /129❤️/);
+});
+
+test('json of records', () => {
+  const json = JSON.parse(convertFile(makeFitFile(1000, 30), { type: 'json', offset: 500, smoothness: 3 }));
+  assert.equal(json.offset, 500);
+  assert.equal(json.units, 'metric');
+  // smoothed between the records
+  assert.ok(json.records.length > 30);
+});
+
+test('output is a view of the heap', () => {
+  const file = makeFitFile(1000, 10);
+  const input = fitconvert.input(file.length);
+  input.view.set(file);
+  const output = fitconvert.convert(input, { type: 'json' });
+  assert.equal(output.bytes.buffer, fitconvert.module.HEAPU8.buffer);
+  output.free();
+  input.free();
+});
+
+test('broken file is reported', () => {
+  const file = makeFitFile(1000, 10);
+  file[file.length - 1] ^= 0xff;
+  const input = fitconvert.input(file.length);
+  input.view.set(file);
+  const output = fitconvert.convert(input, { type: 'vtt' });
+  assert.equal(output.ok, false);
+  output.free();
+  input.free();
+});
+
+test('unknown type is rejected', () => {
+  const input = fitconvert.input(1);
+  assert.throws(() => fitconvert.convert(input, { type: 'srt' }), TypeError);
+  input.free();
+});
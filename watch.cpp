@@ -0,0 +1,244 @@
+/*
+
+ MIT License
+
+ Copyright (c) 2025 pavel.sokolov@gmail.com / CEZEO software Ltd. All rights reserved.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "watch.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// stop is checked at least this often
+constexpr int kPollTimeoutMs = 100;
+constexpr size_t kEventsBufferSize = 64u * 1024u;
+
+bool IsFitFile(const std::filesystem::path& path) {
+  std::string extension = path.extension().string();
+  std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+  return extension == ".fit";
+}
+
+// files are converted by a fixed number of threads, a file queued again before its conversion is started is converted once.
+// the queue is finished before the destruction
+class ConvertQueue {
+ public:
+  ConvertQueue(const size_t workers, const std::function<void(const std::filesystem::path&)>& convert) : convert_(convert) {
+    for (size_t index = 0u; index < workers; ++index) {
+      threads_.emplace_back([this]() { Work(); });
+    }
+  }
+
+  ~ConvertQueue() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    condition_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  ConvertQueue(const ConvertQueue&) = delete;
+  ConvertQueue& operator=(const ConvertQueue&) = delete;
+
+  void Push(const std::filesystem::path& path) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (!queued_.insert(path.string()).second) {
+        return;
+      }
+      files_.push_back(path);
+    }
+    condition_.notify_one();
+  }
+
+ private:
+  void Work() {
+    for (;;) {
+      std::filesystem::path path;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return stopped_ || !files_.empty(); });
+        if (files_.empty()) {
+          return;
+        }
+        path = std::move(files_.front());
+        files_.pop_front();
+        queued_.erase(path.string());
+      }
+      try {
+        convert_(path);
+      } catch (const std::exception& e) {
+        SPDLOG_WARN("'{}' can not be converted: {}", path.string(), e.what());
+      }
+    }
+  }
+
+  const std::function<void(const std::filesystem::path&)>& convert_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::filesystem::path> files_;
+  std::unordered_set<std::string> queued_;
+  bool stopped_{false};
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace
+
+bool WatchDirectory(const std::filesystem::path& directory, const size_t workers, const int64_t debounce_ms, const std::atomic<bool>& stop,
+                    const std::function<void(const std::filesystem::path&)>& convert) {
+#ifdef __linux__
+  const int inotify_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_descriptor < 0) {
+    SPDLOG_ERROR("inotify can not be initialized: {}", std::strerror(errno));
+    return false;
+  }
+  // modifications only postpone the files that are already closed once
+  if (inotify_add_watch(inotify_descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MODIFY) < 0) {
+    SPDLOG_ERROR("'{}' can not be watched: {}", directory.string(), std::strerror(errno));
+    close(inotify_descriptor);
+    return false;
+  }
+  const std::chrono::milliseconds debounce(std::max<int64_t>(debounce_ms, 0));
+  bool watching{true};
+  {
+    ConvertQueue queue(std::max<size_t>(workers, 1u), convert);
+    // written files and the time they are queued at if they are not written again
+    std::unordered_map<std::string, Clock::time_point> pending;
+    std::vector<char> events(kEventsBufferSize);
+    SPDLOG_INFO("watching '{}' for .fit files", directory.string());
+    while (watching && !stop) {
+      int timeout_ms = kPollTimeoutMs;
+      const Clock::time_point now = Clock::now();
+      for (auto it = pending.begin(); it != pending.end();) {
+        if (it->second <= now) {
+          queue.Push(directory / it->first);
+          it = pending.erase(it);
+        } else {
+          const auto wait = std::chrono::ceil<std::chrono::milliseconds>(it->second - now).count();
+          timeout_ms = std::min(timeout_ms, static_cast<int>(wait));
+          ++it;
+        }
+      }
+      pollfd poll_descriptor{inotify_descriptor, POLLIN, 0};
+      const int ready = poll(&poll_descriptor, 1, timeout_ms);
+      if (ready < 0 && errno != EINTR) {
+        SPDLOG_ERROR("'{}' can not be watched: {}", directory.string(), std::strerror(errno));
+        watching = false;
+      }
+      if (ready <= 0) {
+        continue;
+      }
+      ssize_t length = 0;
+      while ((length = read(inotify_descriptor, events.data(), events.size())) > 0) {
+        const Clock::time_point written = Clock::now();
+        for (ssize_t offset = 0; offset < length;) {
+          const auto* event_ptr = reinterpret_cast<const inotify_event*>(events.data() + offset);
+          offset += static_cast<ssize_t>(sizeof(inotify_event) + event_ptr->len);
+          if ((event_ptr->mask & IN_Q_OVERFLOW) != 0u) {
+            // events are lost in a burst, every .fit file of the directory is converted again
+            SPDLOG_WARN("too many files at once in '{}', all of them are converted", directory.string());
+            for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+              if (entry.is_regular_file() && IsFitFile(entry.path())) {
+                pending[entry.path().filename().string()] = written + debounce;
+              }
+            }
+            continue;
+          }
+          if ((event_ptr->mask & IN_IGNORED) != 0u) {
+            SPDLOG_ERROR("'{}' is removed", directory.string());
+            watching = false;
+            break;
+          }
+          if (event_ptr->len == 0u || !IsFitFile(event_ptr->name)) {
+            continue;
+          }
+          if ((event_ptr->mask & IN_MODIFY) != 0u) {
+            auto it = pending.find(event_ptr->name);
+            if (it != pending.end()) {
+              it->second = written + debounce;
+            }
+            continue;
+          }
+          pending[event_ptr->name] = written + debounce;
+        }
+      }
+    }
+    // the files closed last are converted without waiting, the queue is finished by the destructor
+    SPDLOG_INFO("watching '{}' is stopped", directory.string());
+    for (const auto& [name, time] : pending) {
+      queue.Push(directory / name);
+    }
+  }
+  close(inotify_descriptor);
+  return watching;
+#else
+  (void)directory;
+  (void)workers;
+  (void)debounce_ms;
+  (void)stop;
+  (void)convert;
+  SPDLOG_ERROR("watching a directory is supported only on linux");
+  return false;
+#endif
+}
+
+void WriteFileAtomically(const std::filesystem::path& path, const char* data_ptr, const size_t size) {
+  // unique name for conversions of the same file at the same time, the last rename wins
+  static std::atomic<uint64_t> writes{0u};
+  std::filesystem::path temporary_path(path);
+  temporary_path.replace_filename("." + path.filename().string() + "." + std::to_string(writes++) + ".tmp");
+  try {
+    {
+      std::ofstream output_stream(temporary_path, std::ios::out | std::ios::trunc | std::ios::binary);
+      output_stream.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+      output_stream.write(data_ptr, static_cast<std::streamsize>(size));
+    }
+    std::filesystem::rename(temporary_path, path);
+  } catch (const std::exception&) {
+    std::error_code error;
+    std::filesystem::remove(temporary_path, error);
+    throw;
+  }
+}